@@ -6,6 +6,7 @@
 #include "internal/iterbase.hpp"
 
 #include <array>
+#include <functional>
 #include <iterator>
 #include <optional>
 #include <tuple>
@@ -96,6 +97,15 @@ class iter::impl::Chained {
   Chained(TupType&& t) : tup_(std::move(t)) {}
   TupType tup_;
 
+  // When every chained iterable is contiguous (see IsContiguous), iteration
+  // walks raw pointers one segment at a time instead of going through the
+  // per-element dispatch tables in IteratorData.
+  static constexpr bool all_contiguous =
+      (is_contiguous<std::tuple_element_t<Is, TupType>> && ...);
+
+  static constexpr bool all_const_contiguous =
+      (is_contiguous<AsConst<std::tuple_element_t<Is, TupType>>> && ...);
+
  public:
   Chained(Chained&&) = default;
 
@@ -159,24 +169,148 @@ class iter::impl::Chained {
     }
   };
 
-  Iterator<TupType> begin() {
-    return {0, {get_begin(std::get<Is>(tup_))...},
-        {get_end(std::get<Is>(tup_))...}};
+  // Iterator over chained contiguous iterables.  Holds a [begin, end)
+  // pointer pair per iterable and only looks at the next pair when the
+  // current one is exhausted, so the per-element work is a pointer
+  // increment and compare.
+  template <typename FirstContainer>
+  class ContiguousIterator {
+   private:
+    using Ptr = decltype(std::data(std::declval<FirstContainer&>()));
+    using PtrArray = std::array<Ptr, sizeof...(Is)>;
+
+    std::size_t index_;
+    Ptr cur_{};
+    Ptr seg_end_{};
+    PtrArray begins_;
+    PtrArray ends_;
+
+    void skip_empty_segments() {
+      while (index_ < sizeof...(Is) && begins_[index_] == ends_[index_]) {
+        ++index_;
+      }
+      if (index_ < sizeof...(Is)) {
+        cur_ = begins_[index_];
+        seg_end_ = ends_[index_];
+      } else {
+        cur_ = seg_end_ = nullptr;
+      }
+    }
+
+   public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = std::remove_reference_t<decltype(*std::declval<Ptr>())>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = value_type*;
+    using reference = value_type&;
+
+    ContiguousIterator(std::size_t i, PtrArray begins, PtrArray ends)
+        : index_{i}, begins_(begins), ends_(ends) {
+      skip_empty_segments();
+    }
+
+    decltype(auto) operator*() {
+      return *cur_;
+    }
+
+    Ptr operator->() {
+      return cur_;
+    }
+
+    ContiguousIterator& operator++() {
+      ++cur_;
+      if (cur_ == seg_end_) {
+        ++index_;
+        skip_empty_segments();
+      }
+      return *this;
+    }
+
+    ContiguousIterator operator++(int) {
+      auto ret = *this;
+      ++*this;
+      return ret;
+    }
+
+    bool operator!=(const ContiguousIterator& other) const {
+      return index_ != other.index_ || cur_ != other.cur_;
+    }
+
+    bool operator==(const ContiguousIterator& other) const {
+      return !(*this != other);
+    }
+  };
+
+ private:
+  using IteratorType = std::conditional_t<all_contiguous,
+      ContiguousIterator<std::tuple_element_t<0, TupType>>, Iterator<TupType>>;
+
+  using ConstIteratorType = std::conditional_t<all_const_contiguous,
+      ContiguousIterator<AsConst<std::tuple_element_t<0, TupType>>>,
+      Iterator<AsConst<TupType>>>;
+
+ public:
+  IteratorType begin() {
+    if constexpr (all_contiguous) {
+      return {0, {{std::data(std::get<Is>(tup_))...}},
+          {{std::data(std::get<Is>(tup_))
+              + std::size(std::get<Is>(tup_))...}}};
+    } else {
+      return {0, {get_begin(std::get<Is>(tup_))...},
+          {get_end(std::get<Is>(tup_))...}};
+    }
+  }
+
+  IteratorType end() {
+    if constexpr (all_contiguous) {
+      return {sizeof...(Is), {}, {}};
+    } else {
+      return {sizeof...(Is), {get_end(std::get<Is>(tup_))...},
+          {get_end(std::get<Is>(tup_))...}};
+    }
+  }
+
+  ConstIteratorType begin() const {
+    if constexpr (all_const_contiguous) {
+      return {0, {{std::data(std::as_const(std::get<Is>(tup_)))...}},
+          {{std::data(std::as_const(std::get<Is>(tup_)))
+              + std::size(std::get<Is>(tup_))...}}};
+    } else {
+      return {0, {get_begin(std::as_const(std::get<Is>(tup_)))...},
+          {get_end(std::as_const(std::get<Is>(tup_)))...}};
+    }
+  }
+
+  ConstIteratorType end() const {
+    if constexpr (all_const_contiguous) {
+      return {sizeof...(Is), {}, {}};
+    } else {
+      return {sizeof...(Is), {get_end(std::as_const(std::get<Is>(tup_)))...},
+          {get_end(std::as_const(std::get<Is>(tup_)))...}};
+    }
   }
 
-  Iterator<TupType> end() {
-    return {sizeof...(Is), {get_end(std::get<Is>(tup_))...},
-        {get_end(std::get<Is>(tup_))...}};
+  // Calls func once on each chained iterable, in order.  The iterables
+  // are visited one at a time so each gets its own loop over its own
+  // iterator type, with no dispatch between elements.
+  //   ch.for_each_segment([&](auto&& seg) { out.append(seg); });
+  template <typename Func>
+  void for_each_segment(Func func) {
+    (std::invoke(func, std::get<Is>(tup_)), ...);
   }
 
-  Iterator<AsConst<TupType>> begin() const {
-    return {0, {get_begin(std::as_const(std::get<Is>(tup_)))...},
-        {get_end(std::as_const(std::get<Is>(tup_)))...}};
+  template <typename Func>
+  void for_each_segment(Func func) const {
+    (std::invoke(func, std::as_const(std::get<Is>(tup_))), ...);
   }
 
-  Iterator<AsConst<TupType>> end() const {
-    return {sizeof...(Is), {get_end(std::as_const(std::get<Is>(tup_)))...},
-        {get_end(std::as_const(std::get<Is>(tup_)))...}};
+  // Total number of elements, available when every chained iterable works
+  // with std::size()
+  template <typename T = TupType,
+      typename = std::enable_if_t<(
+          has_size<std::tuple_element_t<Is, T>> && ...)>>
+  std::size_t size() const {
+    return (std::size_t{0} + ... + std::size(std::get<Is>(tup_)));
   }
 };
 
@@ -204,28 +338,22 @@ class iter::impl::ChainedFromIterable {
     std::optional<SubIter> sub_iter_p_;
     std::optional<SubIter> sub_end_p_;
 
-    void advance_while_empty_sub_iterable() {
-      while (top_level_iter_ != top_level_end_ && sub_iter_p_ == sub_end_p_) {
-        ++top_level_iter_;
-        update_sub_iterable();
-      }
-    }
-
-    void update_sub_iterable() {
-      if (top_level_iter_ != top_level_end_) {
+    // Moves to the first non-empty sub iterable at or after
+    // top_level_iter_.  Empty sub iterables are recognized by comparing
+    // their begin and end, without touching the stored sub iterators.
+    void next_sub_iterable() {
+      for (; top_level_iter_ != top_level_end_; ++top_level_iter_) {
         sub_iterable_.reset(*top_level_iter_);
-        sub_iter_p_ =
-            std::make_optional<SubIter>(get_begin(sub_iterable_.get()));
-        sub_end_p_ = std::make_optional<SubIter>(get_end(sub_iterable_.get()));
-      } else {
-        sub_iter_p_.reset();
-        sub_end_p_.reset();
+        SubIter sub_begin = get_begin(sub_iterable_.get());
+        SubIter sub_end = get_end(sub_iterable_.get());
+        if (sub_begin != sub_end) {
+          sub_iter_p_.emplace(std::move(sub_begin));
+          sub_end_p_.emplace(std::move(sub_end));
+          return;
+        }
       }
-    }
-
-    void next_sub_iterable() {
-      update_sub_iterable();
-      advance_while_empty_sub_iterable();
+      sub_iter_p_.reset();
+      sub_end_p_.reset();
     }
 
    public:
@@ -294,6 +422,38 @@ class iter::impl::ChainedFromIterable {
     return {
         get_end(std::as_const(container_)), get_end(std::as_const(container_))};
   }
+
+  // Calls func once on each contained iterable, in order, so each can
+  // be processed in its own loop rather than element by element through
+  // the flattening iterator.
+  //   chain.from_iterable(vv).for_each_segment(
+  //       [&](auto&& seg) { out.insert(out.end(), begin(seg), end(seg)); });
+  template <typename Func>
+  void for_each_segment(Func func) {
+    for (auto&& sub : container_) {
+      std::invoke(func, sub);
+    }
+  }
+
+  template <typename Func>
+  void for_each_segment(Func func) const {
+    for (auto&& sub : std::as_const(container_)) {
+      std::invoke(func, sub);
+    }
+  }
+
+  // Total number of elements, available when the contained iterables work
+  // with std::size().  Runs in time linear in the number of contained
+  // iterables.
+  template <typename T = Container,
+      typename = std::enable_if_t<has_size<const_iterator_type_deref<T>>>>
+  std::size_t size() const {
+    std::size_t result{0};
+    for (auto&& sub : std::as_const(container_)) {
+      result += std::size(sub);
+    }
+    return result;
+  }
 };
 
 class iter::impl::ChainMaker {
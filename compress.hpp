@@ -4,17 +4,121 @@
 #include "internal/iterator_wrapper.hpp"
 #include "internal/iterbase.hpp"
 
+#include <algorithm>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
 #include <iterator>
+#include <limits>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace iter {
   namespace impl {
     template <typename Container, typename Selector>
     class Compressed;
+
+    // A non-owning view of num_bits bits packed into 64 bit words, lowest
+    // bit first.  Made by iter::bitmask()
+    class BitMask {
+     private:
+      const std::uint64_t* words_;
+      std::size_t num_bits_;
+
+     public:
+      BitMask(const std::uint64_t* words, std::size_t num_bits)
+          : words_{words}, num_bits_{num_bits} {}
+
+      std::size_t size() const {
+        return num_bits_;
+      }
+
+      bool operator[](std::size_t i) const {
+        return (words_[i / 64] >> (i % 64)) & 1;
+      }
+
+      std::uint64_t word(std::size_t w) const {
+        return words_[w];
+      }
+    };
+
+    // IsBitSelector<T> if T packs its selectors as bits, letting compress
+    // look at 64 of them at a time
+    template <typename T>
+    struct IsBitSelector : std::false_type {};
+
+    template <std::size_t N>
+    struct IsBitSelector<std::bitset<N>> : std::true_type {};
+
+    template <typename Alloc>
+    struct IsBitSelector<std::vector<bool, Alloc>> : std::true_type {};
+
+    template <>
+    struct IsBitSelector<BitMask> : std::true_type {};
+
+    template <typename T>
+    constexpr bool is_bit_selector = IsBitSelector<std::decay_t<T>>::value;
+
+    // count bits from first to first + count (at most 64) packed into a word.
+    // std::bitset and std::vector<bool> don't expose their storage, so
+    // their bits are gathered one at a time, without branching
+    template <typename Bits>
+    std::uint64_t bits_word(
+        const Bits& bits, std::size_t first, std::size_t count) {
+      std::uint64_t word = 0;
+      for (std::size_t i = 0; i < count; ++i) {
+        word |= std::uint64_t{bits[first + i]} << i;
+      }
+      return word;
+    }
+
+    inline std::uint64_t bits_word(
+        const BitMask& bits, std::size_t first, std::size_t count) {
+      std::uint64_t word = bits.word(first / 64);
+      return count < 64 ? word & ((std::uint64_t{1} << count) - 1) : word;
+    }
+
+    inline int count_trailing_zeros(std::uint64_t word) {
+#ifdef __GNUC__
+      return __builtin_ctzll(word);
+#else
+      int n = 0;
+      for (; !(word & 1); word >>= 1) {
+        ++n;
+      }
+      return n;
+#endif
+    }
+
+    inline std::size_t popcount(std::uint64_t word) {
+#ifdef __GNUC__
+      return static_cast<std::size_t>(__builtin_popcountll(word));
+#else
+      std::size_t n = 0;
+      for (; word; word &= word - 1) {
+        ++n;
+      }
+      return n;
+#endif
+    }
   }
 
   template <typename Container, typename Selector>
   impl::Compressed<Container, Selector> compress(Container&&, Selector&&);
+
+  // Views the first num_bits bits of a contiguous container of uint64_t
+  // words, lowest bit first, as selectors for compress.  The words must
+  // outlive the view.
+  template <typename Words>
+  impl::BitMask bitmask(const Words& words, std::size_t num_bits) {
+    return {std::data(words), num_bits};
+  }
+
+  template <typename Words>
+  impl::BitMask bitmask(const Words& words) {
+    return {std::data(words), std::size(words) * 64};
+  }
 }
 
 template <typename Container, typename Selector>
@@ -105,28 +209,168 @@ class iter::impl::Compressed {
     }
   };
 
-  Iterator<Container, Selector> begin() {
-    return {get_begin(container_), get_end(container_), get_begin(selectors_),
-        get_end(selectors_)};
+  // Used instead of Iterator when the selectors are packed bits.  Rather
+  // than testing every selector, it looks at a 64 bit word of them at a
+  // time and jumps straight to the next set bit, advancing the container's
+  // iterator over the whole gap at once, which is O(1) for random access
+  // iterators.
+  template <typename ContainerT, typename SelectorT>
+  class BitIterator {
+   private:
+    template <typename, typename>
+    friend class BitIterator;
+    using Bits = std::decay_t<SelectorT>;
+    static constexpr std::size_t WORD_BITS = 64;
+    static constexpr std::size_t DONE = std::numeric_limits<std::size_t>::max();
+
+    IteratorWrapper<ContainerT> sub_iter_;
+    IteratorWrapper<ContainerT> sub_end_;
+    const Bits* bits_;
+    std::size_t limit_;
+    // position of sub_iter_ in the container, or DONE
+    std::size_t pos_{};
+    std::size_t next_word_{};
+    // set bits of the word before next_word_ that haven't been visited
+    std::uint64_t word_{};
+
+    void seek_next() {
+      while (word_ == 0) {
+        const std::size_t first = next_word_ * WORD_BITS;
+        if (first >= limit_) {
+          pos_ = DONE;
+          return;
+        }
+        word_ = bits_word(*bits_, first, std::min(WORD_BITS, limit_ - first));
+        ++next_word_;
+      }
+      const std::size_t target = (next_word_ - 1) * WORD_BITS
+                                 + static_cast<std::size_t>(
+                                       count_trailing_zeros(word_));
+      word_ &= word_ - 1;
+      dumb_advance(sub_iter_, sub_end_, target - pos_);
+      pos_ = target;
+      // limit_ only accounts for the container when it has a size
+      if constexpr (!has_size<ContainerT>) {
+        if (!(sub_iter_ != sub_end_)) {
+          pos_ = DONE;
+        }
+      }
+    }
+
+   public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = iterator_traits_deref<ContainerT>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = value_type*;
+    using reference = value_type&;
+
+    BitIterator(IteratorWrapper<ContainerT>&& cont_iter,
+        IteratorWrapper<ContainerT>&& cont_end, const Bits& bits,
+        std::size_t limit, bool at_end)
+        : sub_iter_{std::move(cont_iter)},
+          sub_end_{std::move(cont_end)},
+          bits_{&bits},
+          limit_{limit} {
+      if (at_end) {
+        pos_ = DONE;
+      } else {
+        seek_next();
+      }
+    }
+
+    iterator_deref<ContainerT> operator*() {
+      return *sub_iter_;
+    }
+
+    iterator_arrow<ContainerT> operator->() {
+      return apply_arrow(sub_iter_);
+    }
+
+    BitIterator& operator++() {
+      seek_next();
+      return *this;
+    }
+
+    BitIterator operator++(int) {
+      auto ret = *this;
+      ++*this;
+      return ret;
+    }
+
+    template <typename T, typename U>
+    bool operator!=(const BitIterator<T, U>& other) const {
+      return pos_ != other.pos_;
+    }
+
+    template <typename T, typename U>
+    bool operator==(const BitIterator<T, U>& other) const {
+      return !(*this != other);
+    }
+  };
+
+ private:
+  template <typename ContainerT, typename SelectorT>
+  using IteratorType = std::conditional_t<is_bit_selector<SelectorT>,
+      BitIterator<ContainerT, SelectorT>, Iterator<ContainerT, SelectorT>>;
+
+  // number of bits that can select an element
+  template <typename ContainerT>
+  static std::size_t bit_limit(
+      ContainerT& container, const std::decay_t<Selector>& bits) {
+    if constexpr (has_size<ContainerT>) {
+      return std::min<std::size_t>(bits.size(), std::size(container));
+    } else {
+      return bits.size();
+    }
+  }
+
+  template <typename ContainerT, typename SelectorT>
+  static IteratorType<ContainerT, SelectorT> make_iter(
+      ContainerT& container, SelectorT& selectors, bool at_end) {
+    if constexpr (is_bit_selector<SelectorT>) {
+      return {get_begin(container), get_end(container), selectors,
+          bit_limit<ContainerT>(container, selectors), at_end};
+    } else if (at_end) {
+      return {get_end(container), get_end(container), get_end(selectors),
+          get_end(selectors)};
+    } else {
+      return {get_begin(container), get_end(container), get_begin(selectors),
+          get_end(selectors)};
+    }
   }
 
-  Iterator<Container, Selector> end() {
-    return {get_end(container_), get_end(container_), get_end(selectors_),
-        get_end(selectors_)};
+ public:
+  IteratorType<Container, Selector> begin() {
+    return make_iter<Container, Selector>(container_, selectors_, false);
   }
 
-  Iterator<AsConst<Container>, AsConst<Selector>> begin() const {
-    return {get_begin(std::as_const(container_)),
-        get_end(std::as_const(container_)),
-        get_begin(std::as_const(selectors_)),
-        get_end(std::as_const(selectors_))};
+  IteratorType<Container, Selector> end() {
+    return make_iter<Container, Selector>(container_, selectors_, true);
   }
 
-  Iterator<AsConst<Container>, AsConst<Selector>> end() const {
-    return {get_end(std::as_const(container_)),
-        get_end(std::as_const(container_)),
-        get_end(std::as_const(selectors_)),
-        get_end(std::as_const(selectors_))};
+  IteratorType<AsConst<Container>, AsConst<Selector>> begin() const {
+    return make_iter<AsConst<Container>, AsConst<Selector>>(
+        std::as_const(container_), std::as_const(selectors_), false);
+  }
+
+  IteratorType<AsConst<Container>, AsConst<Selector>> end() const {
+    return make_iter<AsConst<Container>, AsConst<Selector>>(
+        std::as_const(container_), std::as_const(selectors_), true);
+  }
+
+  // Number of selected elements, the popcount of the selector bits that
+  // line up with the container.  Only available for packed bit selectors
+  // and sized containers.
+  template <typename C = Container,
+      typename = std::enable_if_t<is_bit_selector<Selector> && has_size<C>>>
+  std::size_t size() const {
+    const std::size_t limit = bit_limit<AsConst<C>>(container_, selectors_);
+    std::size_t count = 0;
+    for (std::size_t first = 0; first < limit; first += 64) {
+      const std::size_t count_bits = std::min<std::size_t>(64, limit - first);
+      count += popcount(bits_word(selectors_, first, count_bits));
+    }
+    return count;
   }
 };
 
@@ -4,6 +4,7 @@
 #include "filter.hpp"
 #include "internal/iterator_wrapper.hpp"
 #include "internal/iterbase.hpp"
+#include "internal/partitioned.hpp"
 
 #include <functional>
 #include <iterator>
@@ -17,6 +18,12 @@ namespace iter {
     using DropWhileFn = IterToolFnOptionalBindFirst<Dropper, BoolTester>;
   }
   constexpr impl::DropWhileFn dropwhile{};
+
+  // dropwhile for input that is partitioned by the predicate, such as
+  // sorted input with a predicate like "less than x".  Finds where the
+  // predicate turns false by binary search rather than calling it on every
+  // element, and yields a range of the input's own iterators
+  constexpr impl::DropWhilePartitionedFn dropwhile_partitioned{};
 }
 
 template <typename FilterFunc, typename Container>
@@ -4,9 +4,14 @@
 #include "internal/iterator_wrapper.hpp"
 #include "internal/iterbase.hpp"
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <initializer_list>
 #include <iterator>
+#include <memory>
+#include <type_traits>
 #include <utility>
 
 namespace iter {
@@ -21,10 +26,26 @@ namespace iter {
       }
     };
 
+    // IsBatchFilterable<C> if C is contiguous and holds arithmetic values
+    template <typename Container, typename = void>
+    struct IsBatchFilterable : std::false_type {};
+
+    template <typename Container>
+    struct IsBatchFilterable<Container,
+        std::enable_if_t<is_contiguous<Container>>>
+        : std::is_arithmetic<
+              std::remove_reference_t<iterator_deref<Container>>> {};
+
+    template <typename FilterFunc, typename Container>
+    class BatchFiltered;
+
     using FilterFn = IterToolFnOptionalBindFirst<Filtered, BoolTester>;
+    using FilterBatchedFn =
+        IterToolFnOptionalBindFirst<BatchFiltered, BoolTester>;
   }
 
   constexpr impl::FilterFn filter{};
+  constexpr impl::FilterBatchedFn filter_batched{};
 }
 
 template <typename FilterFunc, typename Container>
@@ -148,4 +169,173 @@ class iter::impl::Filtered {
   }
 };
 
+// filter_batched is filter for contiguous iterables of arithmetic values that
+// runs the predicate over a block of elements at a time, ahead of the
+// element being yielded.  Other iterables are filtered one element at a
+// time, as filter does.
+template <typename FilterFunc, typename Container>
+class iter::impl::BatchFiltered {
+ private:
+  Container container_;
+  mutable FilterFunc filter_func_;
+
+  friend FilterBatchedFn;
+
+  BatchFiltered(FilterFunc filter_func, Container&& container)
+      : container_(std::forward<Container>(container)),
+        filter_func_(filter_func) {}
+
+ public:
+  BatchFiltered(BatchFiltered&&) = default;
+
+  // Used instead of Filtered's Iterator over contiguous arithmetic values.
+  // Rather than branching on the predicate for each element, it runs the
+  // predicate over a block of elements at a time and unconditionally writes
+  // each offset into a selection vector, only moving past it when the
+  // predicate passed.  Dereferencing and incrementing then just walk the
+  // selection vector.  The selection vector is shared between copies of
+  // the iterator, as with any input iterator only the one most recently
+  // incremented can be incremented again.  As with Filtered's Iterator,
+  // nothing is evaluated until first use.
+  template <typename ContainerT>
+  class BatchIterator {
+   private:
+    template <typename>
+    friend class BatchIterator;
+    using Elem = std::remove_reference_t<iterator_deref<ContainerT>>;
+    static constexpr std::size_t BLOCK_SIZE = 256;
+
+    struct Selection {
+      std::uint8_t offsets[BLOCK_SIZE];
+      std::size_t block_len{};
+      std::size_t pos{};
+      std::size_t size{};
+    };
+
+    mutable Elem* block_;
+    Elem* end_;
+    FilterFunc* filter_func_;
+    // the element yielded, once it has been found
+    mutable Elem* current_{};
+    mutable std::shared_ptr<Selection> sel_;
+
+    // scans blocks starting at block_ until one has at least one element
+    // that passes the predicate, or the end is reached
+    void fill_blocks() const {
+      while (block_ != end_) {
+        if (!sel_) {
+          sel_ = std::make_shared<Selection>();
+        }
+        auto& sel = *sel_;
+        sel.pos = 0;
+        sel.size = 0;
+        sel.block_len = std::min<std::size_t>(
+            BLOCK_SIZE, static_cast<std::size_t>(end_ - block_));
+        for (std::size_t i = 0; i < sel.block_len; ++i) {
+          sel.offsets[sel.size] = static_cast<std::uint8_t>(i);
+          sel.size += static_cast<bool>(std::invoke(*filter_func_, block_[i]));
+        }
+        if (sel.size != 0) {
+          current_ = block_ + sel.offsets[0];
+          return;
+        }
+        block_ += sel.block_len;
+      }
+      current_ = end_;
+    }
+
+    Elem* current() const {
+      if (!current_) {
+        fill_blocks();
+      }
+      return current_;
+    }
+
+   public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = iterator_traits_deref<ContainerT>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = value_type*;
+    using reference = value_type&;
+
+    BatchIterator(Elem* first, Elem* last, FilterFunc& filter_func)
+        : block_{first}, end_{last}, filter_func_(&filter_func) {}
+
+    Elem& operator*() {
+      return *current();
+    }
+
+    Elem* operator->() {
+      return current();
+    }
+
+    BatchIterator& operator++() {
+      current();
+      auto& sel = *sel_;
+      if (++sel.pos == sel.size) {
+        block_ += sel.block_len;
+        fill_blocks();
+      } else {
+        current_ = block_ + sel.offsets[sel.pos];
+      }
+      return *this;
+    }
+
+    BatchIterator operator++(int) {
+      auto ret = *this;
+      ++*this;
+      return ret;
+    }
+
+    template <typename T>
+    bool operator!=(const BatchIterator<T>& other) const {
+      return current() != other.current();
+    }
+
+    template <typename T>
+    bool operator==(const BatchIterator<T>& other) const {
+      return !(*this != other);
+    }
+  };
+
+ private:
+  template <typename ContainerT>
+  using IteratorType = std::conditional_t<IsBatchFilterable<ContainerT>::value,
+      BatchIterator<ContainerT>,
+      typename Filtered<FilterFunc, Container>::template Iterator<ContainerT>>;
+
+  template <typename ContainerT>
+  static IteratorType<ContainerT> make_iter(
+      ContainerT& container, FilterFunc& filter_func, bool at_end) {
+    if constexpr (IsBatchFilterable<ContainerT>::value) {
+      auto first = std::data(container);
+      auto last = first + std::size(container);
+      return {at_end ? last : first, last, filter_func};
+    } else if (at_end) {
+      return {get_end(container), get_end(container), filter_func};
+    } else {
+      return {get_begin(container), get_end(container), filter_func};
+    }
+  }
+
+ public:
+  IteratorType<Container> begin() {
+    return make_iter<Container>(container_, filter_func_, false);
+  }
+
+  IteratorType<Container> end() {
+    return make_iter<Container>(container_, filter_func_, true);
+  }
+
+  IteratorType<AsConst<Container>> begin() const {
+    return make_iter<AsConst<Container>>(
+        std::as_const(container_), filter_func_, false);
+  }
+
+  IteratorType<AsConst<Container>> end() const {
+    return make_iter<AsConst<Container>>(
+        std::as_const(container_), filter_func_, true);
+  }
+};
+
 #endif
@@ -0,0 +1,203 @@
+#ifndef ITER_GATHER_HPP_
+#define ITER_GATHER_HPP_
+
+#include "internal/iterator_wrapper.hpp"
+#include "internal/iterbase.hpp"
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace iter {
+  namespace impl {
+    template <typename Container, typename Indices>
+    class Gathered;
+
+    struct GatherFn;
+    struct ScatterFn;
+
+    // how many indices ahead of the current one gather and scatter prefetch
+    constexpr std::size_t DEFAULT_PREFETCH_DISTANCE = 16;
+  }
+}
+
+// Yields container[i] for each i in indices.  A second iterator into the
+// indices runs `distance` positions ahead of the one being dereferenced and
+// prefetches the element it refers to, so that by the time it is reached it
+// has (hopefully) already been loaded.  This means the indices are
+// iterated twice, so they must be multipass.
+template <typename Container, typename Indices>
+class iter::impl::Gathered {
+ private:
+  Container container_;
+  Indices indices_;
+  std::size_t distance_;
+
+  friend GatherFn;
+
+  Gathered(Container&& container, Indices&& indices, std::size_t distance)
+      : container_(std::forward<Container>(container)),
+        indices_(std::forward<Indices>(indices)),
+        distance_{distance} {}
+
+ public:
+  Gathered(Gathered&&) = default;
+
+  template <typename ContainerT, typename IndicesT>
+  class Iterator {
+   private:
+    template <typename, typename>
+    friend class Iterator;
+    iterator_type<ContainerT> data_;
+    IteratorWrapper<IndicesT> index_iter_;
+    IteratorWrapper<IndicesT> ahead_iter_;
+    IteratorWrapper<IndicesT> index_end_;
+
+    auto element_at(IteratorWrapper<IndicesT>& it) {
+      return data_
+             + static_cast<typename std::iterator_traits<
+                 iterator_type<ContainerT>>::difference_type>(*it);
+    }
+
+    void prefetch_ahead() {
+      if (ahead_iter_ != index_end_) {
+        auto target = element_at(ahead_iter_);
+        prefetch_deref(target);
+        ++ahead_iter_;
+      }
+    }
+
+   public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = iterator_traits_deref<ContainerT>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = value_type*;
+    using reference = value_type&;
+
+    Iterator(iterator_type<ContainerT>&& data,
+        IteratorWrapper<IndicesT>&& index_iter,
+        IteratorWrapper<IndicesT>&& index_end, std::size_t distance)
+        : data_(std::move(data)),
+          index_iter_{std::move(index_iter)},
+          ahead_iter_{index_iter_},
+          index_end_{std::move(index_end)} {
+      for (std::size_t i = 0; i < distance; ++i) {
+        prefetch_ahead();
+      }
+    }
+
+    iterator_deref<ContainerT> operator*() {
+      return *element_at(index_iter_);
+    }
+
+    iterator_arrow<ContainerT> operator->() {
+      auto it = element_at(index_iter_);
+      return apply_arrow(it);
+    }
+
+    Iterator& operator++() {
+      prefetch_ahead();
+      ++index_iter_;
+      return *this;
+    }
+
+    Iterator operator++(int) {
+      auto ret = *this;
+      ++*this;
+      return ret;
+    }
+
+    template <typename T, typename U>
+    bool operator!=(const Iterator<T, U>& other) const {
+      return index_iter_ != other.index_iter_;
+    }
+
+    template <typename T, typename U>
+    bool operator==(const Iterator<T, U>& other) const {
+      return !(*this != other);
+    }
+  };
+
+  Iterator<Container, Indices> begin() {
+    return {get_begin(container_), get_begin(indices_), get_end(indices_),
+        distance_};
+  }
+
+  Iterator<Container, Indices> end() {
+    return {get_begin(container_), get_end(indices_), get_end(indices_), 0};
+  }
+
+  Iterator<AsConst<Container>, AsConst<Indices>> begin() const {
+    return {get_begin(std::as_const(container_)),
+        get_begin(std::as_const(indices_)), get_end(std::as_const(indices_)),
+        distance_};
+  }
+
+  Iterator<AsConst<Container>, AsConst<Indices>> end() const {
+    return {get_begin(std::as_const(container_)),
+        get_end(std::as_const(indices_)), get_end(std::as_const(indices_)),
+        0};
+  }
+
+  // one element for each index
+  template <typename T = Indices, typename = std::enable_if_t<has_size<T>>>
+  std::size_t size() const {
+    return std::size(indices_);
+  }
+};
+
+struct iter::impl::GatherFn {
+  template <typename Container, typename Indices,
+      typename = std::enable_if_t<is_random_access_iterable<Container>
+                                  && is_iterable<Indices>>>
+  Gathered<Container, Indices> operator()(Container&& container,
+      Indices&& indices,
+      std::size_t distance = DEFAULT_PREFETCH_DISTANCE) const {
+    return {std::forward<Container>(container),
+        std::forward<Indices>(indices), distance};
+  }
+};
+
+// The reverse of gather, assigns each of the values to out[i] for the
+// corresponding i in indices, stopping at the end of whichever is shorter.
+// The element `distance` indices ahead is prefetched for writing.
+struct iter::impl::ScatterFn {
+  template <typename Indices, typename Values, typename Container,
+      typename = std::enable_if_t<is_iterable<Indices> && is_iterable<Values>
+                                  && is_random_access_iterable<Container>>>
+  void operator()(Indices&& indices, Values&& values, Container&& out,
+      std::size_t distance = DEFAULT_PREFETCH_DISTANCE) const {
+    using Diff = typename std::iterator_traits<
+        iterator_type<Container>>::difference_type;
+    auto out_begin = get_begin(out);
+    auto index_it = get_begin(indices);
+    auto ahead_it = get_begin(indices);
+    auto index_end = get_end(indices);
+    auto prefetch_ahead = [&] {
+      if (ahead_it != index_end) {
+        auto target = out_begin + static_cast<Diff>(*ahead_it);
+        prefetch_deref<true>(target);
+        ++ahead_it;
+      }
+    };
+    for (std::size_t i = 0; i < distance; ++i) {
+      prefetch_ahead();
+    }
+
+    auto value_end = get_end(values);
+    for (auto value_it = get_begin(values);
+         index_it != index_end && value_it != value_end;
+         ++index_it, ++value_it) {
+      prefetch_ahead();
+      out_begin[static_cast<Diff>(*index_it)] = *value_it;
+    }
+  }
+};
+
+namespace iter {
+  constexpr impl::GatherFn gather{};
+  constexpr impl::ScatterFn scatter{};
+}
+
+#endif
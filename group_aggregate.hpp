@@ -0,0 +1,356 @@
+#ifndef ITER_GROUP_AGGREGATE_HPP_
+#define ITER_GROUP_AGGREGATE_HPP_
+
+#include "internal/flat_hash_set.hpp"
+#include "internal/iterbase.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace iter {
+  namespace impl {
+    // An aggregator turns the elements of a group into a single value.
+    // start(e) gives the value for a group's first element, and add(v, e)
+    // folds each further element into it.  proj picks what is aggregated
+    // out of each element.
+
+    struct CountAgg {
+      template <typename T>
+      std::size_t start(const T&) const {
+        return 1;
+      }
+
+      template <typename T>
+      void add(std::size_t& n, const T&) const {
+        ++n;
+      }
+    };
+
+    // The type a sum of T is kept in, unless one is given.  Integers are
+    // summed in at least a long long and floating point values in at least
+    // a double, so summing small types doesn't overflow or lose precision
+    template <typename T, typename = void>
+    struct SumType : type_is<T> {};
+
+    template <typename T>
+    struct SumType<T, std::enable_if_t<std::is_integral_v<T>>>
+        : type_is<std::common_type_t<T, long long>> {};
+
+    template <typename T>
+    struct SumType<T, std::enable_if_t<std::is_floating_point_v<T>>>
+        : type_is<std::common_type_t<T, double>> {};
+
+    template <typename Proj, typename Result = void>
+    struct SumAgg {
+      Proj proj;
+
+      template <typename T>
+      auto start(const T& e) const {
+        using ProjVal =
+            std::decay_t<std::invoke_result_t<const Proj&, const T&>>;
+        using Sum = std::conditional_t<std::is_void_v<Result>,
+            typename SumType<ProjVal>::type, Result>;
+        return Sum(std::invoke(proj, e));
+      }
+
+      template <typename V, typename T>
+      void add(V& v, const T& e) const {
+        v += std::invoke(proj, e);
+      }
+    };
+
+    template <typename Proj>
+    struct MinAgg {
+      Proj proj;
+
+      template <typename T>
+      auto start(const T& e) const {
+        return std::decay_t<std::invoke_result_t<const Proj&, const T&>>(
+            std::invoke(proj, e));
+      }
+
+      template <typename V, typename T>
+      void add(V& v, const T& e) const {
+        decltype(auto) p = std::invoke(proj, e);
+        if (p < v) {
+          v = std::forward<decltype(p)>(p);
+        }
+      }
+    };
+
+    template <typename Proj>
+    struct MaxAgg {
+      Proj proj;
+
+      template <typename T>
+      auto start(const T& e) const {
+        return std::decay_t<std::invoke_result_t<const Proj&, const T&>>(
+            std::invoke(proj, e));
+      }
+
+      template <typename V, typename T>
+      void add(V& v, const T& e) const {
+        decltype(auto) p = std::invoke(proj, e);
+        if (v < p) {
+          v = std::forward<decltype(p)>(p);
+        }
+      }
+    };
+
+    template <typename Proj>
+    struct FirstAgg {
+      Proj proj;
+
+      template <typename T>
+      auto start(const T& e) const {
+        return std::decay_t<std::invoke_result_t<const Proj&, const T&>>(
+            std::invoke(proj, e));
+      }
+
+      template <typename V, typename T>
+      void add(V&, const T&) const {}
+    };
+
+    template <typename Proj>
+    struct LastAgg {
+      Proj proj;
+
+      template <typename T>
+      auto start(const T& e) const {
+        return std::decay_t<std::invoke_result_t<const Proj&, const T&>>(
+            std::invoke(proj, e));
+      }
+
+      template <typename V, typename T>
+      void add(V& v, const T& e) const {
+        v = std::invoke(proj, e);
+      }
+    };
+
+    // v = func(v, e) for each element, starting from init
+    template <typename Value, typename Func>
+    struct FoldAgg {
+      Value init;
+      Func func;
+
+      template <typename T>
+      Value start(const T& e) const {
+        return std::invoke(func, init, e);
+      }
+
+      template <typename T>
+      void add(Value& v, const T& e) const {
+        v = std::invoke(func, std::move(v), e);
+      }
+    };
+
+    template <typename Key, typename Values>
+    class GroupAggregated;
+
+    struct GroupAggregateFn;
+  }
+
+  // aggregators for group_aggregate
+  namespace agg {
+    constexpr impl::CountAgg count() {
+      return {};
+    }
+
+    // sum<Result>(proj) keeps the sum in a Result
+    template <typename Result = void, typename Proj = impl::Identity>
+    constexpr impl::SumAgg<Proj, Result> sum(Proj proj = {}) {
+      return {std::move(proj)};
+    }
+
+    template <typename Proj = impl::Identity>
+    constexpr impl::MinAgg<Proj> min(Proj proj = {}) {
+      return {std::move(proj)};
+    }
+
+    template <typename Proj = impl::Identity>
+    constexpr impl::MaxAgg<Proj> max(Proj proj = {}) {
+      return {std::move(proj)};
+    }
+
+    template <typename Proj = impl::Identity>
+    constexpr impl::FirstAgg<Proj> first(Proj proj = {}) {
+      return {std::move(proj)};
+    }
+
+    template <typename Proj = impl::Identity>
+    constexpr impl::LastAgg<Proj> last(Proj proj = {}) {
+      return {std::move(proj)};
+    }
+
+    template <typename Value, typename Func>
+    constexpr impl::FoldAgg<Value, Func> fold(Value init, Func func) {
+      return {std::move(init), std::move(func)};
+    }
+  }
+}
+
+// Holds the (key, aggregated values) pair of each group, in the order the
+// groups' first elements came in
+template <typename Key, typename Values>
+class iter::impl::GroupAggregated {
+ private:
+  using Group = std::pair<Key, Values>;
+  std::vector<Group> groups_;
+
+  friend GroupAggregateFn;
+
+  GroupAggregated(std::vector<Group>&& groups) : groups_(std::move(groups)) {}
+
+ public:
+  GroupAggregated(GroupAggregated&&) = default;
+
+  auto begin() {
+    return groups_.begin();
+  }
+
+  auto end() {
+    return groups_.end();
+  }
+
+  auto begin() const {
+    return groups_.begin();
+  }
+
+  auto end() const {
+    return groups_.end();
+  }
+
+  std::size_t size() const {
+    return groups_.size();
+  }
+};
+
+// Groups the elements by key without needing them to be sorted, computing
+// each aggregator over each group in a single pass.  Groups are kept in a
+// vector in order of first appearance, and a FlatHashSet of indices into it
+// finds the group for a key.  Keys are hashed and compared as the key
+// function returns them, and only copied when a new group starts.
+struct iter::impl::GroupAggregateFn : Pipeable<GroupAggregateFn> {
+ private:
+  struct IndexHash {
+    const std::vector<std::size_t>* hashes;
+    std::size_t operator()(std::size_t i) const {
+      return (*hashes)[i];
+    }
+  };
+
+  template <typename Groups>
+  struct IndexEqual {
+    const Groups* groups;
+    bool operator()(std::size_t lhs, std::size_t rhs) const {
+      return (*groups)[lhs].first == (*groups)[rhs].first;
+    }
+  };
+
+  template <typename Container, typename KeyFunc, typename... Aggs>
+  static auto aggregate(Container&& container, KeyFunc& key_func,
+      std::size_t expected, const Aggs&... aggs) {
+    using Elem = iterator_deref<Container>;
+    using Key = std::decay_t<std::invoke_result_t<KeyFunc&, Elem>>;
+    using Values = std::tuple<std::decay_t<decltype(
+        aggs.start(std::declval<const std::remove_reference_t<Elem>&>()))>...>;
+    using Groups = std::vector<std::pair<Key, Values>>;
+
+    Groups groups;
+    std::vector<std::size_t> hashes;
+    FlatHashSet<std::size_t, IndexHash, IndexEqual<Groups>> index{
+        IndexHash{&hashes}, IndexEqual<Groups>{&groups}};
+    groups.reserve(expected);
+    hashes.reserve(expected);
+    index.reserve(expected);
+
+    auto end_it = get_end(container);
+    for (auto it = get_begin(container); it != end_it; ++it) {
+      decltype(auto) e = *it;
+      decltype(auto) key = std::invoke(key_func, e);
+      const std::size_t hash = std::hash<Key>{}(key);
+      const std::size_t* found = index.find(
+          hash, [&groups, &key](std::size_t i) {
+            return groups[i].first == key;
+          });
+      if (found) {
+        auto& values = groups[*found].second;
+        std::apply(
+            [&e, &aggs...](auto&... vs) {
+              (aggs.add(vs, std::as_const(e)), ...);
+            },
+            values);
+      } else {
+        groups.emplace_back(std::forward<decltype(key)>(key),
+            Values{aggs.start(std::as_const(e))...});
+        hashes.push_back(hash);
+        index.insert(groups.size() - 1);
+      }
+    }
+    return GroupAggregated<Key, Values>{std::move(groups)};
+  }
+
+  template <typename KeyFunc, typename TupleType, std::size_t... Is>
+  static auto aggregate_tuple(KeyFunc& key_func, std::size_t expected,
+      TupleType&& args, std::index_sequence<Is...>) {
+    return aggregate(std::get<0>(std::move(args)), key_func, expected,
+        std::get<Is + 1>(args)...);
+  }
+
+  template <typename KeyFunc, typename... Args>
+  struct FnPartial : Pipeable<FnPartial<KeyFunc, Args...>> {
+    KeyFunc key_func;
+    std::tuple<Args...> args;
+
+    template <typename Container>
+    auto operator()(Container&& container) const {
+      return std::apply(
+          [&container, this](const Args&... as) {
+            return GroupAggregateFn{}(
+                std::forward<Container>(container), key_func, as...);
+          },
+          args);
+    }
+  };
+
+ public:
+  // The arguments after the key function are the aggregators, optionally
+  // followed by the number of groups to expect, which sizes the tables up
+  // front so they don't need to grow along the way
+  template <typename Container, typename KeyFunc, typename... Args,
+      typename = std::enable_if_t<is_iterable<Container>>>
+  auto operator()(
+      Container&& container, KeyFunc key_func, Args&&... args) const {
+    auto arg_tup = std::forward_as_tuple(
+        std::forward<Container>(container), std::forward<Args>(args)...);
+    constexpr std::size_t last = sizeof...(Args);
+    using LastArg = std::decay_t<std::tuple_element_t<last, decltype(arg_tup)>>;
+    if constexpr (last > 0 && std::is_integral_v<LastArg>) {
+      return aggregate_tuple(key_func,
+          static_cast<std::size_t>(std::get<last>(arg_tup)),
+          std::move(arg_tup), std::make_index_sequence<last - 1>{});
+    } else {
+      return aggregate_tuple(key_func, 0, std::move(arg_tup),
+          std::make_index_sequence<last>{});
+    }
+  }
+
+  template <typename KeyFunc, typename... Args,
+      typename = std::enable_if_t<!is_iterable<KeyFunc>>>
+  FnPartial<std::decay_t<KeyFunc>, std::decay_t<Args>...> operator()(
+      KeyFunc&& key_func, Args&&... args) const {
+    return {{}, std::forward<KeyFunc>(key_func),
+        {std::forward<Args>(args)...}};
+  }
+};
+
+namespace iter {
+  constexpr impl::GroupAggregateFn group_aggregate{};
+}
+
+#endif
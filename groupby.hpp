@@ -6,6 +6,8 @@
 #include "internal/iterator_wrapper.hpp"
 #include "internal/iterbase.hpp"
 
+#include <algorithm>
+#include <cstddef>
 #include <functional>
 #include <iterator>
 #include <memory>
@@ -15,28 +17,61 @@
 
 namespace iter {
   namespace impl {
-    template <typename Container, typename KeyFunc>
+    template <typename Container, typename KeyFunc, bool Sorted = false>
     class GroupProducer;
 
-    struct Identity {
-      template <typename T>
-      const T& operator()(const T& t) const {
-        return t;
+    template <typename Container, typename KeyFunc>
+    using SortedGroupProducer = GroupProducer<Container, KeyFunc, true>;
+
+    // Given the number of elements left and has_key(i), which tells whether
+    // the element i ahead of the current one is in the current group,
+    // returns the index of the first one that isn't, or remaining if they
+    // all are.  The group must be contiguous.  Probes 1, 2, 4, ... elements
+    // ahead until it finds one outside the group or the end, then binary
+    // searches the last gap, so it takes O(log n) calls for a group of n
+    // elements.
+    template <typename HasKey>
+    std::ptrdiff_t gallop_group_end(std::ptrdiff_t remaining, HasKey has_key) {
+      // the element at lo is in the group, the one at hi isn't or is the end
+      std::ptrdiff_t lo = 0;
+      std::ptrdiff_t hi = 1;
+      while (hi < remaining && has_key(hi)) {
+        lo = hi;
+        hi *= 2;
       }
-    };
+      hi = std::min(hi, remaining);
+      while (hi - lo > 1) {
+        const std::ptrdiff_t mid = lo + (hi - lo) / 2;
+        if (has_key(mid)) {
+          lo = mid;
+        } else {
+          hi = mid;
+        }
+      }
+      return hi;
+    }
 
     using GroupByFn = IterToolFnOptionalBindSecond<GroupProducer, Identity>;
+    using GroupBySortedFn =
+        IterToolFnOptionalBindSecond<SortedGroupProducer, Identity>;
   }
   constexpr impl::GroupByFn groupby{};
+
+  // groupby_sorted is groupby for input where all the elements with the same
+  // key are next to each other, such as input sorted by key.  On random
+  // access input it finds the end of a group that isn't iterated through by
+  // searching for it, rather than calling the key function on each element
+  constexpr impl::GroupBySortedFn groupby_sorted{};
 }
 
-template <typename Container, typename KeyFunc>
+template <typename Container, typename KeyFunc, bool Sorted>
 class iter::impl::GroupProducer {
  private:
   Container container_;
   mutable KeyFunc key_func_;
 
   friend GroupByFn;
+  friend GroupBySortedFn;
 
   template <typename T>
   using key_func_ret = std::invoke_result_t<KeyFunc, iterator_deref<T>>;
@@ -53,10 +88,17 @@ class iter::impl::GroupProducer {
   class Group;
 
  private:
-  template <typename T>
-  using KeyGroupPair = std::pair<key_func_ret<T>, Group<T>>;
   template <typename T>
   using Holder = DerefHolder<iterator_deref<T>>;
+  // The type keys are held as.  A reference returned by the key function
+  // may point into the element, and elements that are yielded by value are
+  // only held while they're the current one, so in that case the key is
+  // copied.  Otherwise references are held as they are.
+  template <typename T>
+  using key_type = std::conditional_t<Holder<T>::stores_value,
+      std::decay_t<key_func_ret<T>>, key_func_ret<T>>;
+  template <typename T>
+  using KeyGroupPair = std::pair<key_type<T>, Group<T>>;
 
  public:
   template <typename ContainerT>
@@ -67,10 +109,20 @@ class iter::impl::GroupProducer {
     IteratorWrapper<ContainerT> sub_iter_;
     IteratorWrapper<ContainerT> sub_end_;
     Holder<ContainerT> item_;
+    // the key of item_, so the key function is called once per element
+    DerefHolder<key_type<ContainerT>> key_;
     KeyFunc* key_func_;
     std::optional<KeyGroupPair<ContainerT>> current_key_group_pair_;
 
    public:
+    // true if the end of a group can be found by galloping over the
+    // elements instead of stepping through them one by one
+    static constexpr bool gallops =
+        Sorted
+        && std::is_same_v<IteratorWrapper<ContainerT>,
+               iterator_type<ContainerT>>
+        && is_random_access_iter<iterator_type<ContainerT>>::value;
+
     using iterator_category = std::input_iterator_tag;
     using value_type = KeyGroupPair<ContainerT>;
     using difference_type = std::ptrdiff_t;
@@ -83,7 +135,7 @@ class iter::impl::GroupProducer {
           sub_end_{std::move(sub_end)},
           key_func_(&key_func) {
       if (sub_iter_ != sub_end_) {
-        item_.reset(*sub_iter_);
+        reset_item();
       }
     }
 
@@ -91,6 +143,7 @@ class iter::impl::GroupProducer {
         : sub_iter_{other.sub_iter_},
           sub_end_{other.sub_end_},
           item_{other.item_},
+          key_{other.key_},
           key_func_{other.key_func_} {}
 
     Iterator& operator=(const Iterator& other) {
@@ -100,6 +153,7 @@ class iter::impl::GroupProducer {
       sub_iter_ = other.sub_iter_;
       sub_end_ = other.sub_end_;
       item_ = other.item_;
+      key_ = other.key_;
       key_func_ = other.key_func_;
       current_key_group_pair_.reset();
       return *this;
@@ -148,7 +202,7 @@ class iter::impl::GroupProducer {
       if (sub_iter_ != sub_end_) {
         ++sub_iter_;
         if (sub_iter_ != sub_end_) {
-          item_.reset(*sub_iter_);
+          reset_item();
         }
       }
     }
@@ -165,14 +219,60 @@ class iter::impl::GroupProducer {
       return item_.get_ptr();
     }
 
-    key_func_ret<ContainerT> next_key() {
-      return std::invoke(*key_func_, item_.get());
+    template <typename T>
+    key_type<ContainerT> key_of(T&& item) {
+      return static_cast<key_type<ContainerT>>(
+          std::invoke(*key_func_, std::forward<T>(item)));
+    }
+
+    void reset_item() {
+      item_.reset(*sub_iter_);
+      key_.reset(key_of(item_.get()));
+    }
+
+    typename DerefHolder<key_type<ContainerT>>::reference next_key() {
+      return key_.get();
+    }
+
+    // The number of elements from the current one up to the first one
+    // whose key isn't equal to key.  The current element must have the key.
+    // If boundary_key is given, the key of the element at the returned
+    // distance is left in it.
+    template <typename Key>
+    std::ptrdiff_t group_distance(const Key& key,
+        DerefHolder<key_type<ContainerT>>* boundary_key = nullptr) {
+      static_assert(gallops);
+      auto has_key = [this, &key, boundary_key](std::ptrdiff_t i) {
+        DerefHolder<key_type<ContainerT>> probe;
+        probe.reset(key_of(sub_iter_[i]));
+        if (probe.get() == key) {
+          return true;
+        }
+        if (boundary_key) {
+          *boundary_key = std::move(probe);
+        }
+        return false;
+      };
+      return gallop_group_end(sub_end_ - sub_iter_, has_key);
+    }
+
+    // moves past the rest of the group with the given key
+    template <typename Key>
+    void skip_group(const Key& key) {
+      DerefHolder<key_type<ContainerT>> next_key;
+      sub_iter_ += group_distance(key, &next_key);
+      if (sub_iter_ != sub_end_) {
+        // the search always ends on an element it found a different key at,
+        // so that key is reused rather than computed again
+        item_.reset(*sub_iter_);
+        key_ = std::move(next_key);
+      }
     }
 
     void set_key_group_pair() {
       if (!current_key_group_pair_) {
-        current_key_group_pair_.emplace(std::invoke(*key_func_, item_.get()),
-            Group<ContainerT>{*this, next_key()});
+        current_key_group_pair_.emplace(
+            key_.get(), Group<ContainerT>{*this, key_.get()});
       }
     }
   };
@@ -184,7 +284,7 @@ class iter::impl::GroupProducer {
     friend class Iterator;
     friend class GroupIterator;
     Iterator<ContainerT>& owner_;
-    key_func_ret<ContainerT> key_;
+    key_type<ContainerT> key_;
 
     // completed is set if a Group is iterated through
     // completely.  It is checked in the destructor, and
@@ -197,17 +297,33 @@ class iter::impl::GroupProducer {
     // when called.
     bool completed = false;
 
-    Group(Iterator<ContainerT>& owner, key_func_ret<ContainerT> key)
+    Group(Iterator<ContainerT>& owner, key_type<ContainerT> key)
         : owner_(owner), key_(key) {}
 
    public:
     ~Group() {
       if (!completed) {
-        for (auto iter = begin(), end_it = end(); iter != end_it; ++iter) {
+        if constexpr (Iterator<ContainerT>::gallops) {
+          owner_.skip_group(key_);
+        } else {
+          for (auto iter = begin(), end_it = end(); iter != end_it; ++iter) {
+          }
         }
       }
     }
 
+    // The number of elements left in the group, which is all of them if it
+    // hasn't been iterated over yet.  Only available from groupby_sorted
+    // over random access input, where it doesn't need to go through them.
+    template <typename T = ContainerT,
+        typename = std::enable_if_t<Iterator<T>::gallops>>
+    std::size_t size() const {
+      if (completed) {
+        return 0;
+      }
+      return static_cast<std::size_t>(owner_.group_distance(key_));
+    }
+
     // move-constructible, non-copy-constructible, non-assignable
     Group(Group&& other) noexcept
         : owner_(other.owner_), key_{other.key_}, completed{other.completed} {
@@ -216,7 +332,7 @@ class iter::impl::GroupProducer {
 
     class GroupIterator {
      private:
-      std::remove_reference_t<key_func_ret<ContainerT>>* key_;
+      const std::remove_reference_t<key_type<ContainerT>>* key_;
       Group* group_p_;
 
       bool not_at_end() {
@@ -232,8 +348,9 @@ class iter::impl::GroupProducer {
       using reference = value_type&;
 
       // TODO template this? idk if it's relevant here
-      GroupIterator(Group* group_p, key_func_ret<ContainerT>& key)
-          : key_{&key}, group_p_{group_p} {}
+      GroupIterator(Group* group_p,
+          const std::remove_reference_t<key_type<ContainerT>>* key)
+          : key_{key}, group_p_{group_p} {}
 
       bool operator!=(const GroupIterator& other) const {
         return !(*this == other);
@@ -268,11 +385,11 @@ class iter::impl::GroupProducer {
     };
 
     GroupIterator begin() {
-      return {this, key_};
+      return {this, &key_};
     }
 
     GroupIterator end() {
-      return {nullptr, key_};
+      return {nullptr, &key_};
     }
   };
 
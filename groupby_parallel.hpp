@@ -0,0 +1,227 @@
+#ifndef ITER_GROUPBY_PARALLEL_HPP_
+#define ITER_GROUPBY_PARALLEL_HPP_
+
+#include "groupby.hpp"
+#include "internal/iterbase.hpp"
+#include "internal/parallel.hpp"
+#include "internal/subrange.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace iter {
+  namespace impl {
+    template <typename Container, typename Key>
+    class ParallelGroups;
+
+    struct GroupByParallelFn;
+  }
+}
+
+// Holds the input along with where each of its groups starts, and yields
+// (key, group) pairs where the group is a Subrange of the input
+template <typename Container, typename Key>
+class iter::impl::ParallelGroups {
+ private:
+  Container container_;
+  // keys_[i] is the key of the group that starts at index starts_[i].
+  // starts_ has one more element at the end, the size of the input
+  std::vector<Key> keys_;
+  std::vector<std::size_t> starts_;
+
+  friend GroupByParallelFn;
+
+  ParallelGroups(Container&& container, std::vector<Key>&& keys,
+      std::vector<std::size_t>&& starts)
+      : container_(std::forward<Container>(container)),
+        keys_(std::move(keys)),
+        starts_(std::move(starts)) {}
+
+ public:
+  ParallelGroups(ParallelGroups&&) = default;
+
+  template <typename ContainerT>
+  class Iterator {
+   private:
+    using SubIter = iterator_type<ContainerT>;
+    using Diff = typename std::iterator_traits<SubIter>::difference_type;
+
+    SubIter first_;
+    const ParallelGroups* groups_;
+    std::size_t index_;
+
+   public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = std::pair<const Key&, Subrange<SubIter>>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = value_type*;
+    using reference = value_type;
+
+    Iterator(SubIter first, const ParallelGroups* groups, std::size_t index)
+        : first_(std::move(first)), groups_{groups}, index_{index} {}
+
+    value_type operator*() const {
+      return {groups_->keys_[index_],
+          {first_ + static_cast<Diff>(groups_->starts_[index_]),
+              first_ + static_cast<Diff>(groups_->starts_[index_ + 1])}};
+    }
+
+    ArrowProxy<value_type> operator->() const {
+      return {**this};
+    }
+
+    Iterator& operator++() {
+      ++index_;
+      return *this;
+    }
+
+    Iterator operator++(int) {
+      auto ret = *this;
+      ++*this;
+      return ret;
+    }
+
+    template <typename T>
+    bool operator!=(const Iterator<T>& other) const {
+      return index_ != other.index_;
+    }
+
+    template <typename T>
+    bool operator==(const Iterator<T>& other) const {
+      return !(*this != other);
+    }
+
+    template <typename>
+    friend class Iterator;
+  };
+
+  Iterator<Container> begin() {
+    return {get_begin(container_), this, 0};
+  }
+
+  Iterator<Container> end() {
+    return {get_begin(container_), this, keys_.size()};
+  }
+
+  Iterator<AsConst<Container>> begin() const {
+    return {get_begin(std::as_const(container_)), this, 0};
+  }
+
+  Iterator<AsConst<Container>> end() const {
+    return {get_begin(std::as_const(container_)), this, keys_.size()};
+  }
+
+  std::size_t size() const {
+    return keys_.size();
+  }
+};
+
+// groupby for sized random access input whose equal keys are all next to
+// each other, as they are when it's sorted by key.  Finds every group up
+// front on several threads:
+//   1) the input is split into one part per thread, and each split point is
+//      moved forward to the end of the group it falls in by galloping, the
+//      same search groupby_sorted uses to skip a group
+//   2) each thread runs through its part, calling the key function once per
+//      element and recording where each group starts
+// The key function is called from several threads at once.
+// The groups are then yielded in order as (key, group) pairs.  Unlike
+// groupby's, these groups are random access ranges of the input that stay
+// valid after moving on to the next group.
+struct iter::impl::GroupByParallelFn : Pipeable<GroupByParallelFn> {
+ private:
+  template <typename KeyFunc>
+  struct FnPartial : Pipeable<FnPartial<KeyFunc>> {
+    mutable KeyFunc key_func;
+    std::size_t num_threads;
+
+    template <typename Container>
+    auto operator()(Container&& container) const {
+      return GroupByParallelFn{}(
+          std::forward<Container>(container), key_func, num_threads);
+    }
+  };
+
+ public:
+  template <typename Container, typename KeyFunc = Identity,
+      typename = std::enable_if_t<is_indexable<Container>>>
+  auto operator()(Container&& container, KeyFunc key_func = {},
+      std::size_t num_threads = std::thread::hardware_concurrency()) const {
+    using Key = std::decay_t<std::invoke_result_t<KeyFunc&,
+        iterator_deref<Container>>>;
+    using Diff = typename std::iterator_traits<
+        iterator_type<Container>>::difference_type;
+    const std::size_t size = std::size(container);
+    auto first = get_begin(container);
+    auto key_at = [&first, &key_func](std::size_t i) -> Key {
+      return std::invoke(key_func, first[static_cast<Diff>(i)]);
+    };
+
+    const std::size_t num_parts = std::max<std::size_t>(
+        std::min<std::size_t>(num_threads, size / MIN_PARALLEL_BLOCK_SIZE), 1);
+    // part p is [splits[p], splits[p + 1]).  Moving a split point to the
+    // end of its group can leave some parts empty
+    std::vector<std::size_t> splits(num_parts + 1, size);
+    splits[0] = 0;
+    for (std::size_t p = 1; p < num_parts; ++p) {
+      const std::size_t split = std::max(p * (size / num_parts), splits[p - 1]);
+      if (split == 0 || split >= size) {
+        splits[p] = split;
+        continue;
+      }
+      // the group of the element before the split point ends where it does
+      const Key key = key_at(split - 1);
+      splits[p] = split - 1
+                  + static_cast<std::size_t>(gallop_group_end(
+                      static_cast<std::ptrdiff_t>(size - (split - 1)),
+                      [&key_at, &key, split](std::ptrdiff_t i) {
+                        return key_at(split - 1 + static_cast<std::size_t>(i))
+                               == key;
+                      }));
+    }
+
+    std::vector<std::vector<Key>> part_keys(num_parts);
+    std::vector<std::vector<std::size_t>> part_starts(num_parts);
+    run_parallel(num_parts, [&](std::size_t p) {
+      auto& keys = part_keys[p];
+      auto& starts = part_starts[p];
+      for (std::size_t i = splits[p]; i < splits[p + 1]; ++i) {
+        Key key = key_at(i);
+        if (keys.empty() || !(keys.back() == key)) {
+          keys.push_back(std::move(key));
+          starts.push_back(i);
+        }
+      }
+    });
+
+    std::vector<Key> keys;
+    std::vector<std::size_t> starts;
+    for (std::size_t p = 0; p < num_parts; ++p) {
+      std::move(part_keys[p].begin(), part_keys[p].end(),
+          std::back_inserter(keys));
+      starts.insert(starts.end(), part_starts[p].begin(), part_starts[p].end());
+    }
+    starts.push_back(size);
+    return ParallelGroups<Container, Key>{
+        std::forward<Container>(container), std::move(keys), std::move(starts)};
+  }
+
+  template <typename KeyFunc,
+      typename = std::enable_if_t<!is_iterable<KeyFunc>>>
+  FnPartial<std::decay_t<KeyFunc>> operator()(KeyFunc&& key_func,
+      std::size_t num_threads = std::thread::hardware_concurrency()) const {
+    return {{}, std::forward<KeyFunc>(key_func), num_threads};
+  }
+};
+
+namespace iter {
+  constexpr impl::GroupByParallelFn groupby_parallel{};
+}
+
+#endif
@@ -1,22 +1,194 @@
 #ifndef ITER_IMAP_H_
 #define ITER_IMAP_H_
 
-#include "starmap.hpp"
-#include "zip.hpp"
+#include "internal/iter_tuples.hpp"
+#include "internal/iterbase.hpp"
 
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
 #include <utility>
 
 namespace iter {
   namespace impl {
-    struct IMapFn : PipeableAndBindFirst<IMapFn> {
-      template <typename MapFunc, typename... Containers>
-      decltype(auto) operator()(
-          MapFunc map_func, Containers&&... containers) const {
-        return starmap(map_func, zip(std::forward<Containers>(containers)...));
+    template <typename MapFunc, typename TupleType, std::size_t... Is>
+    class IMapper;
+
+    struct IMapFn;
+    struct ReduceFn;
+  }
+}
+
+// Holds an iterator into each container and calls the function directly on
+// the dereferenced iterators, so no tuple of the elements is ever built
+// and unpacked again.
+template <typename MapFunc, typename TupleType, std::size_t... Is>
+class iter::impl::IMapper {
+ private:
+  mutable MapFunc map_func_;
+  TupleType containers_;
+
+  friend IMapFn;
+  // reads the containers to sum products with a fused multiply-add
+  friend ReduceFn;
+
+  IMapper(MapFunc map_func, TupleType&& containers)
+      : map_func_(std::move(map_func)), containers_(std::move(containers)) {}
+
+  // As with zip, when every container is sized and random access the
+  // Iterator advances one index instead of every sub iterator, which keeps
+  // loops over imap simple enough for compilers to vectorize.
+  template <typename TupleTypeT>
+  static constexpr bool all_indexable = (... && is_indexable<
+      std::tuple_element_t<Is, std::remove_reference_t<TupleTypeT>>>);
+
+  std::size_t min_size() const {
+    return std::min({static_cast<std::size_t>(
+        std::size(std::get<Is>(containers_)))...});
+  }
+
+ public:
+  IMapper(IMapper&&) = default;
+
+  template <typename TupleTypeT, template <typename> class IteratorTuple>
+  class Iterator {
+    // see gcc bug 87651
+#if NO_GCC_FRIEND_ERROR
+   private:
+    template <typename, template <typename> class>
+    friend class Iterator;
+#else
+   public:
+#endif
+    MapFunc* map_func_;
+    IteratorTuple<TupleTypeT> iters_;
+    // only used when indexed, otherwise iters_ are advanced directly
+    std::size_t index_;
+
+   public:
+    static constexpr bool indexed = all_indexable<TupleTypeT>;
+
+    using iterator_category = std::input_iterator_tag;
+    using value_type = std::remove_reference_t<decltype(std::invoke(
+        std::declval<MapFunc&>(),
+        *std::get<Is>(std::declval<IteratorTuple<TupleTypeT>&>())...))>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = value_type*;
+    using reference = value_type&;
+
+    Iterator(MapFunc& map_func, IteratorTuple<TupleTypeT>&& iters,
+        std::size_t index = 0)
+        : map_func_(&map_func), iters_(std::move(iters)), index_{index} {}
+
+    Iterator& operator++() {
+      if constexpr (indexed) {
+        ++index_;
+      } else {
+        absorb(++std::get<Is>(iters_)...);
       }
-      using PipeableAndBindFirst<IMapFn>::operator();
-    };
+      return *this;
+    }
+
+    Iterator operator++(int) {
+      auto ret = *this;
+      ++*this;
+      return ret;
+    }
+
+    // like zip, stops when any of the iterators reaches its end
+    template <typename T, template <typename> class IT>
+    bool operator!=(const Iterator<T, IT>& other) const {
+      if constexpr (indexed) {
+        return index_ != other.index_;
+      } else {
+        return (... && (std::get<Is>(iters_) != std::get<Is>(other.iters_)));
+      }
+    }
+
+    template <typename T, template <typename> class IT>
+    bool operator==(const Iterator<T, IT>& other) const {
+      return !(*this != other);
+    }
+
+    decltype(auto) operator*() {
+      if constexpr (indexed) {
+        return std::invoke(*map_func_,
+            std::get<Is>(iters_)[static_cast<difference_type>(index_)]...);
+      } else {
+        return std::invoke(*map_func_, *std::get<Is>(iters_)...);
+      }
+    }
+
+    auto operator-> () -> ArrowProxy<decltype(**this)> {
+      return {**this};
+    }
+  };
+
+  Iterator<TupleType, iterator_tuple_type> begin() {
+    return {map_func_, {get_begin(std::get<Is>(containers_))...}};
+  }
+
+  Iterator<TupleType, iterator_tuple_type> end() {
+    if constexpr (Iterator<TupleType, iterator_tuple_type>::indexed) {
+      return {map_func_, {get_begin(std::get<Is>(containers_))...},
+          min_size()};
+    } else {
+      return {map_func_, {get_end(std::get<Is>(containers_))...}};
+    }
+  }
+
+  Iterator<AsConst<TupleType>, const_iterator_tuple_type> begin() const {
+    return {map_func_,
+        {get_begin(std::as_const(std::get<Is>(containers_)))...}};
+  }
+
+  Iterator<AsConst<TupleType>, const_iterator_tuple_type> end() const {
+    if constexpr (Iterator<AsConst<TupleType>,
+                      const_iterator_tuple_type>::indexed) {
+      return {map_func_,
+          {get_begin(std::as_const(std::get<Is>(containers_)))...},
+          min_size()};
+    } else {
+      return {
+          map_func_, {get_end(std::as_const(std::get<Is>(containers_)))...}};
+    }
   }
+
+  // Length of the shortest container, available when every container
+  // works with std::size()
+  template <typename T = TupleType,
+      typename =
+          std::enable_if_t<(... && has_size<std::tuple_element_t<Is, T>>)>>
+  std::size_t size() const {
+    return min_size();
+  }
+};
+
+struct iter::impl::IMapFn : PipeableAndBindFirst<IMapFn> {
+ private:
+  template <typename MapFunc, typename TupleType, std::size_t... Is>
+  IMapper<MapFunc, TupleType, Is...> imap_impl(MapFunc map_func,
+      TupleType&& containers, std::index_sequence<Is...>) const {
+    return {std::move(map_func), std::move(containers)};
+  }
+
+ public:
+  template <typename MapFunc, typename Container, typename... Containers>
+  auto operator()(MapFunc map_func, Container&& container,
+      Containers&&... containers) const {
+    return imap_impl(std::move(map_func),
+        std::tuple<Container, Containers...>{
+            std::forward<Container>(container),
+            std::forward<Containers>(containers)...},
+        std::index_sequence_for<Container, Containers...>{});
+  }
+
+  using PipeableAndBindFirst<IMapFn>::operator();
+};
+
+namespace iter {
   constexpr impl::IMapFn imap{};
 }
 
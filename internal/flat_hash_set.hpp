@@ -0,0 +1,209 @@
+#ifndef ITER_FLAT_HASH_SET_HPP_
+#define ITER_FLAT_HASH_SET_HPP_
+
+// FlatHashSet is the insert-only set used by unique_everseen and
+// group_aggregate.  Like the rest of internal/, it is UNDOCUMENTED and
+// subject to change without warning.
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace iter {
+  namespace impl {
+    // An open addressing hash set that keeps its elements in one flat array
+    // rather than a node per element.  A parallel array of control bytes
+    // marks each slot as empty or holds 7 bits of its element's hash, so a
+    // probe can skip most mismatched slots without looking at the element
+    // itself.  Elements are never erased, which keeps probing simple.
+    template <typename T, typename Hash = std::hash<T>,
+        typename KeyEqual = std::equal_to<T>>
+    class FlatHashSet {
+     private:
+      static constexpr std::uint8_t EMPTY = 0x80;
+      static constexpr std::size_t MIN_CAPACITY = 16;
+
+      Hash hash_;
+      KeyEqual equal_;
+      // number of slots minus one.  The number of slots is 0 or a power of 2
+      std::size_t mask_{};
+      std::size_t size_{};
+      std::unique_ptr<std::uint8_t[]> ctrl_;
+      T* slots_{};
+
+      std::size_t capacity() const {
+        return ctrl_ ? mask_ + 1 : 0;
+      }
+
+      // std::hash is the identity for integers on common implementations,
+      // so the hash is mixed before its bits are used to pick a slot
+      static std::uint64_t mix(std::size_t h) {
+        std::uint64_t x = h;
+        x ^= x >> 32;
+        x *= 0x9e3779b97f4a7c15ULL;
+        x ^= x >> 29;
+        return x;
+      }
+
+      static std::uint8_t tag_of(std::uint64_t mixed) {
+        return static_cast<std::uint8_t>(mixed >> 57);
+      }
+
+      // grows to at least `slots` slots, moving the elements over
+      void rehash(std::size_t slots) {
+        std::size_t new_capacity = MIN_CAPACITY;
+        while (new_capacity < slots) {
+          new_capacity *= 2;
+        }
+        FlatHashSet bigger{hash_, equal_};
+        bigger.allocate(new_capacity);
+        for (std::size_t i = 0; i < capacity(); ++i) {
+          if (ctrl_[i] != EMPTY) {
+            bigger.insert_unique(std::move(slots_[i]));
+          }
+        }
+        swap(bigger);
+      }
+
+      void allocate(std::size_t slots) {
+        ctrl_ = std::make_unique<std::uint8_t[]>(slots);
+        for (std::size_t i = 0; i < slots; ++i) {
+          ctrl_[i] = EMPTY;
+        }
+        slots_ = std::allocator<T>{}.allocate(slots);
+        mask_ = slots - 1;
+      }
+
+      // only for values known not to be in the set already
+      void insert_unique(T&& value) {
+        const std::uint64_t mixed = mix(hash_(value));
+        std::size_t i = static_cast<std::size_t>(mixed) & mask_;
+        while (ctrl_[i] != EMPTY) {
+          i = (i + 1) & mask_;
+        }
+        ::new (static_cast<void*>(slots_ + i)) T(std::move(value));
+        ctrl_[i] = tag_of(mixed);
+        ++size_;
+      }
+
+      void destroy() {
+        if (!ctrl_) {
+          return;
+        }
+        for (std::size_t i = 0; i < capacity(); ++i) {
+          if (ctrl_[i] != EMPTY) {
+            slots_[i].~T();
+          }
+        }
+        std::allocator<T>{}.deallocate(slots_, capacity());
+        ctrl_.reset();
+        slots_ = nullptr;
+        mask_ = 0;
+        size_ = 0;
+      }
+
+      void swap(FlatHashSet& other) noexcept {
+        using std::swap;
+        swap(hash_, other.hash_);
+        swap(equal_, other.equal_);
+        swap(mask_, other.mask_);
+        swap(size_, other.size_);
+        swap(ctrl_, other.ctrl_);
+        swap(slots_, other.slots_);
+      }
+
+     public:
+      FlatHashSet(Hash hash = Hash{}, KeyEqual equal = KeyEqual{})
+          : hash_(std::move(hash)), equal_(std::move(equal)) {}
+
+      FlatHashSet(const FlatHashSet& other)
+          : hash_(other.hash_), equal_(other.equal_) {
+        if (other.ctrl_) {
+          allocate(other.capacity());
+          for (std::size_t i = 0; i < capacity(); ++i) {
+            if (other.ctrl_[i] != EMPTY) {
+              ::new (static_cast<void*>(slots_ + i)) T(other.slots_[i]);
+              ctrl_[i] = other.ctrl_[i];
+              ++size_;
+            }
+          }
+        }
+      }
+
+      FlatHashSet(FlatHashSet&& other) noexcept
+          : hash_(other.hash_), equal_(other.equal_) {
+        swap(other);
+      }
+
+      FlatHashSet& operator=(FlatHashSet other) noexcept {
+        swap(other);
+        return *this;
+      }
+
+      ~FlatHashSet() {
+        destroy();
+      }
+
+      // makes room for n elements without rehashing
+      void reserve(std::size_t n) {
+        // keep the load factor at or below 7/8
+        const std::size_t slots = n + n / 7 + 1;
+        if (slots > capacity()) {
+          rehash(slots);
+        }
+      }
+
+      // Adds value if there isn't an equal element already.  Returns true if
+      // it was added
+      template <typename U>
+      bool insert(U&& value) {
+        if ((size_ + 1) * 8 > capacity() * 7) {
+          rehash(capacity() * 2);
+        }
+        const std::uint64_t mixed = mix(hash_(value));
+        const std::uint8_t tag = tag_of(mixed);
+        for (std::size_t i = static_cast<std::size_t>(mixed) & mask_;;
+             i = (i + 1) & mask_) {
+          if (ctrl_[i] == EMPTY) {
+            ::new (static_cast<void*>(slots_ + i)) T(std::forward<U>(value));
+            ctrl_[i] = tag;
+            ++size_;
+            return true;
+          }
+          if (ctrl_[i] == tag && equal_(slots_[i], value)) {
+            return false;
+          }
+        }
+      }
+
+      // Looks for an element with the given hash for which pred returns
+      // true.  Lets an element be found with something other than a T, as
+      // long as hash agrees with what Hash gives for the element.  Returns
+      // nullptr if there isn't one
+      template <typename Pred>
+      const T* find(std::size_t hash, Pred pred) const {
+        if (!ctrl_) {
+          return nullptr;
+        }
+        const std::uint64_t mixed = mix(hash);
+        const std::uint8_t tag = tag_of(mixed);
+        for (std::size_t i = static_cast<std::size_t>(mixed) & mask_;
+             ctrl_[i] != EMPTY; i = (i + 1) & mask_) {
+          if (ctrl_[i] == tag && pred(slots_[i])) {
+            return slots_ + i;
+          }
+        }
+        return nullptr;
+      }
+
+      std::size_t size() const {
+        return size_;
+      }
+    };
+  }
+}
+
+#endif
@@ -75,6 +75,12 @@ class iter::impl::IteratorWrapperImpl {
     return *sub_iter();
   }
 
+  // for random access SubIters, used by zip and imap to index from begin
+  template <typename Diff>
+  decltype(auto) operator[](Diff n) const {
+    return sub_iter()[n];
+  }
+
   decltype(auto) operator-> () {
     return apply_arrow(sub_iter());
   }
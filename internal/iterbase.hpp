@@ -11,6 +11,7 @@
 #include <cstddef>
 #include <functional>
 #include <iterator>
+#include <memory>
 #include <optional>
 #include <tuple>
 #include <type_traits>
@@ -197,8 +198,89 @@ namespace iter {
 
     template <typename T>
     using has_random_access_iter = is_random_access_iter<iterator_type<T>>;
-    // because std::advance assumes a lot and is actually smart, I need a dumb
 
+    // is_forward_iter<I> if I is at least a forward iterator, so a copy of
+    // it can go over the same elements again
+    template <typename, typename = void>
+    struct is_forward_iter : std::false_type {};
+
+    template <typename T>
+    struct is_forward_iter<T,
+        std::enable_if_t<std::is_base_of<std::forward_iterator_tag,
+            typename std::iterator_traits<T>::iterator_category>::value>>
+        : std::true_type {};
+
+    // IsRandomAccessIterable<C> if C is iterable and its iterators are
+    // random access.  Unlike has_random_access_iter this is false, rather than
+    // an error, for types that can't be iterated
+    template <typename T, typename = void>
+    struct IsRandomAccessIterable : std::false_type {};
+
+    template <typename T>
+    struct IsRandomAccessIterable<T, std::void_t<iterator_type<T>>>
+        : is_random_access_iter<iterator_type<T>> {};
+
+    template <typename T>
+    constexpr bool is_random_access_iterable = IsRandomAccessIterable<T>::value;
+
+    // HasSize<C> if std::size() can be called on a C&
+    template <typename T, typename = void>
+    struct HasSize : std::false_type {};
+
+    template <typename T>
+    struct HasSize<T, std::void_t<decltype(std::size(std::declval<T&>()))>>
+        : std::true_type {};
+
+    template <typename T>
+    constexpr bool has_size = HasSize<T>::value;
+
+    // IsIndexable<C> if C is sized and has random access iterators, so its
+    // elements can be reached by indexing from begin
+    template <typename T>
+    struct IsIndexable
+        : std::conjunction<HasSize<T>, IsRandomAccessIterable<T>> {};
+
+    template <typename T>
+    constexpr bool is_indexable = IsIndexable<T>::value;
+
+    // IsContiguous<C> if std::data() gives a pointer to C's elements and
+    // dereferencing that pointer gives the same type as dereferencing one of
+    // C's iterators.  Holds for arrays, std::vector (but not vector<bool>),
+    // std::array, std::string and the like.
+    template <typename T, typename = void>
+    struct IsContiguous : std::false_type {};
+
+    template <typename T>
+    struct IsContiguous<T,
+        std::void_t<decltype(std::data(std::declval<T&>())),
+            decltype(std::size(std::declval<T&>()))>>
+        : std::is_same<decltype(*std::data(std::declval<T&>())),
+              iterator_deref<T>> {};
+
+    template <typename T>
+    constexpr bool is_contiguous = IsContiguous<T>::value;
+
+    // Hints that the object at p will soon be read, or written if ForWrite.
+    // Does nothing where __builtin_prefetch isn't available
+    template <bool ForWrite = false, typename T>
+    void prefetch(const T* p) {
+#ifdef __GNUC__
+      __builtin_prefetch(p, ForWrite ? 1 : 0);
+#else
+      (void)p;
+#endif
+    }
+
+    // prefetch the element an iterator refers to, if it refers to one that
+    // lives in memory.  Iterators that yield prvalues are ignored
+    template <bool ForWrite = false, typename Iter>
+    void prefetch_deref(Iter& it) {
+      if constexpr (std::is_lvalue_reference_v<decltype(*it)>) {
+        prefetch<ForWrite>(std::addressof(*it));
+      }
+    }
+
+    // because std::advance assumes a lot and is actually smart, I need a dumb
     // version that will work with most things
     template <typename InputIt, typename Distance = std::size_t>
     void dumb_advance_unsafe(InputIt& iter, Distance distance) {
@@ -340,6 +422,14 @@ namespace iter {
       }
     };
 
+    // the default key function of tools that take one
+    struct Identity {
+      template <typename T>
+      const T& operator()(const T& t) const {
+        return t;
+      }
+    };
+
     // allows f(x) to be 'called' as x | f
     // let the record show I dislike adding yet another syntactical mess to
     // this clown car of a language.
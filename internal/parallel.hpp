@@ -0,0 +1,33 @@
+#ifndef ITER_PARALLEL_HPP_
+#define ITER_PARALLEL_HPP_
+
+// The block runner shared by scan, top_k, groupby_parallel and
+// unique_everseen_parallel.  Like the rest of internal/, it is UNDOCUMENTED
+// and subject to change without warning.
+
+#include <cstddef>
+#include <future>
+#include <vector>
+
+namespace iter {
+  namespace impl {
+    // blocks smaller than this aren't worth a thread
+    constexpr std::size_t MIN_PARALLEL_BLOCK_SIZE = 1 << 14;
+
+    // calls func(i) for every i in [0, n), each on its own thread except
+    // func(0), which runs on the calling thread, and waits for all of them
+    template <typename Func>
+    void run_parallel(std::size_t n, Func func) {
+      std::vector<std::future<void>> futures;
+      for (std::size_t i = 1; i < n; ++i) {
+        futures.push_back(std::async(std::launch::async, func, i));
+      }
+      func(0);
+      for (auto&& f : futures) {
+        f.get();
+      }
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,110 @@
+#ifndef ITER_PARTITIONED_HPP_
+#define ITER_PARTITIONED_HPP_
+
+// PartitionedView backs takewhile_partitioned and dropwhile_partitioned.
+// Like the rest of internal/, it is UNDOCUMENTED and subject to change
+// without warning.
+
+#include "iterbase.hpp"
+#include "subrange.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <utility>
+
+namespace iter {
+  namespace impl {
+    template <typename FilterFunc, typename Container, bool TakeFront>
+    class PartitionedView;
+
+    template <typename FilterFunc, typename Container>
+    using PartitionedTaker = PartitionedView<FilterFunc, Container, true>;
+
+    template <typename FilterFunc, typename Container>
+    using PartitionedDropper = PartitionedView<FilterFunc, Container, false>;
+
+    struct BoolTester;
+
+    using TakeWhilePartitionedFn =
+        IterToolFnOptionalBindFirst<PartitionedTaker, BoolTester>;
+    using DropWhilePartitionedFn =
+        IterToolFnOptionalBindFirst<PartitionedDropper, BoolTester>;
+  }
+}
+
+// A container that is partitioned by the predicate, with every element it
+// holds for before every element it doesn't, is split where the predicate
+// turns false with std::partition_point.  That takes O(log n) predicate
+// calls, and with random access iterators O(log n) time as well.  The
+// split is found the first time it's needed.  Iterates over the front part
+// if TakeFront, otherwise the back part, as a Subrange.
+template <typename FilterFunc, typename Container, bool TakeFront>
+class iter::impl::PartitionedView {
+ private:
+  Container container_;
+  mutable FilterFunc filter_func_;
+  // how far into the container the split is, once found.  Kept as a
+  // distance rather than an iterator so it stays valid if the view, and
+  // with it an owned container, is moved
+  mutable std::optional<std::ptrdiff_t> split_;
+
+  friend TakeWhilePartitionedFn;
+  friend DropWhilePartitionedFn;
+
+  PartitionedView(FilterFunc filter_func, Container&& container)
+      : container_(std::forward<Container>(container)),
+        filter_func_(filter_func) {}
+
+  template <typename Iter>
+  Subrange<Iter> part(Iter first, Iter last) const {
+    if (!split_) {
+      split_ = std::distance(first,
+          std::partition_point(first, last, [this](const auto& e) {
+            return static_cast<bool>(std::invoke(filter_func_, e));
+          }));
+    }
+    Iter split = std::next(first, *split_);
+    if constexpr (TakeFront) {
+      return {first, split};
+    } else {
+      return {split, last};
+    }
+  }
+
+  Subrange<iterator_type<Container>> part() {
+    return part(get_begin(container_), get_end(container_));
+  }
+
+  Subrange<iterator_type<AsConst<Container>>> part() const {
+    return part(get_begin(std::as_const(container_)),
+        get_end(std::as_const(container_)));
+  }
+
+ public:
+  PartitionedView(PartitionedView&&) = default;
+
+  iterator_type<Container> begin() {
+    return part().begin();
+  }
+
+  iterator_type<Container> end() {
+    return part().end();
+  }
+
+  iterator_type<AsConst<Container>> begin() const {
+    return part().begin();
+  }
+
+  iterator_type<AsConst<Container>> end() const {
+    return part().end();
+  }
+
+  std::size_t size() const {
+    return part().size();
+  }
+};
+
+#endif
@@ -0,0 +1,50 @@
+#ifndef ITER_SUBRANGE_HPP_
+#define ITER_SUBRANGE_HPP_
+
+// Subrange is the view of part of an iterable that groupby_parallel yields
+// as a group, and that takewhile_partitioned and dropwhile_partitioned
+// iterate over.  Like the rest of internal/, it is UNDOCUMENTED and subject
+// to change without warning.
+
+#include <cstddef>
+#include <iterator>
+
+namespace iter {
+  namespace impl {
+    // A pair of iterators that can be iterated over as an iterable.  With
+    // random access iterators it is sized and indexable as well.
+    template <typename Iter>
+    class Subrange {
+     private:
+      Iter first_;
+      Iter last_;
+
+     public:
+      Subrange(Iter first, Iter last) : first_(first), last_(last) {}
+
+      Iter begin() const {
+        return first_;
+      }
+
+      Iter end() const {
+        return last_;
+      }
+
+      bool empty() const {
+        return !(first_ != last_);
+      }
+
+      std::size_t size() const {
+        return static_cast<std::size_t>(std::distance(first_, last_));
+      }
+
+      decltype(auto) operator[](std::size_t i) const {
+        return first_[
+            static_cast<typename std::iterator_traits<Iter>::difference_type>(
+                i)];
+      }
+    };
+  }
+}
+
+#endif
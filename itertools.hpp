@@ -14,20 +14,33 @@
 #include "enumerate.hpp"
 #include "filter.hpp"
 #include "filterfalse.hpp"
+#include "gather.hpp"
+#include "group_aggregate.hpp"
 #include "groupby.hpp"
+#include "groupby_parallel.hpp"
 #include "imap.hpp"
+#include "materialized.hpp"
+#include "memo_imap.hpp"
 #include "permutations.hpp"
 #include "powerset.hpp"
+#include "prefetched.hpp"
 #include "product.hpp"
 #include "range.hpp"
+#include "reduce.hpp"
 #include "repeat.hpp"
 #include "reversed.hpp"
+#include "sample.hpp"
+#include "sample_indices.hpp"
+#include "scan.hpp"
 #include "slice.hpp"
 #include "sliding_window.hpp"
 #include "sorted.hpp"
 #include "starmap.hpp"
 #include "takewhile.hpp"
+#include "top_k.hpp"
 #include "unique_everseen.hpp"
+#include "unique_everseen_approx.hpp"
+#include "unique_everseen_parallel.hpp"
 #include "unique_justseen.hpp"
 #include "zip.hpp"
 
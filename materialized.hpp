@@ -0,0 +1,74 @@
+#ifndef ITER_MATERIALIZED_HPP_
+#define ITER_MATERIALIZED_HPP_
+
+#include "internal/iterbase.hpp"
+
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace iter {
+  namespace impl {
+    template <typename Container>
+    class Materialized;
+
+    using MaterializedFn = IterToolFn<Materialized>;
+  }
+  constexpr impl::MaterializedFn materialized{};
+}
+
+// Runs through the container once, when constructed, and moves or copies
+// each element into a vector that it then iterates over.  sorted,
+// permutations, combinations, chunked, sliding_window, batched and shuffled
+// all hold iterators into their input and dereference them whenever an
+// element is needed, which for inputs like imap means calling the function
+// again each time. Putting materialized in between means each element is
+// only ever computed once, and gives those tools random access iterators.
+template <typename Container>
+class iter::impl::Materialized {
+ private:
+  using Value = std::decay_t<iterator_deref<Container>>;
+  std::vector<Value> values_;
+
+  friend MaterializedFn;
+
+  Materialized(Container&& container) {
+    if constexpr (has_size<Container>) {
+      values_.reserve(std::size(container));
+    }
+    auto end_it = get_end(container);
+    for (auto it = get_begin(container); it != end_it; ++it) {
+      // prvalues and rvalue references are moved from.  Even an rvalue
+      // container may be a view yielding references into someone else's
+      // container, so lvalue references are always copied.
+      values_.emplace_back(*it);
+    }
+  }
+
+ public:
+  Materialized(Materialized&&) = default;
+
+  auto begin() {
+    return values_.begin();
+  }
+
+  auto end() {
+    return values_.end();
+  }
+
+  auto begin() const {
+    return values_.begin();
+  }
+
+  auto end() const {
+    return values_.end();
+  }
+
+  std::size_t size() const {
+    return values_.size();
+  }
+};
+
+#endif
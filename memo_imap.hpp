@@ -0,0 +1,254 @@
+#ifndef ITER_MEMO_IMAP_HPP_
+#define ITER_MEMO_IMAP_HPP_
+
+#include "imap.hpp"
+#include "internal/iterbase.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace iter {
+  namespace impl {
+    // combines the std::hash of each element of a tuple
+    struct TupleHash {
+      template <typename... Ts>
+      std::size_t operator()(const std::tuple<Ts...>& t) const {
+        std::size_t seed = 0;
+        std::apply(
+            [&seed](const Ts&... elems) {
+              ((seed ^= std::hash<Ts>{}(elems) + 0x9e3779b9 + (seed << 6)
+                        + (seed >> 2)),
+                  ...);
+            },
+            t);
+        return seed;
+      }
+    };
+
+    // Keeps the capacity most recently used results, evicting the least
+    // recently used one to make room
+    template <typename Key, typename Value>
+    class LruCache {
+     private:
+      using Entries = std::list<std::pair<Key, Value>>;
+      std::size_t capacity_;
+      // most recently used first
+      Entries entries_;
+      std::unordered_map<Key, typename Entries::iterator, TupleHash> index_;
+
+     public:
+      explicit LruCache(std::size_t capacity) : capacity_{capacity} {}
+
+      const Value* find(const Key& key) {
+        auto it = index_.find(key);
+        if (it == index_.end()) {
+          return nullptr;
+        }
+        entries_.splice(entries_.begin(), entries_, it->second);
+        return &it->second->second;
+      }
+
+      void insert(Key key, Value value) {
+        if (capacity_ == 0) {
+          return;
+        }
+        if (entries_.size() == capacity_) {
+          index_.erase(entries_.back().first);
+          entries_.pop_back();
+        }
+        entries_.emplace_front(std::move(key), std::move(value));
+        index_.emplace(entries_.front().first, entries_.begin());
+      }
+
+      std::size_t size() const {
+        return entries_.size();
+      }
+    };
+
+    // Keeps the capacity results in a ring with a referenced bit each.
+    // To make room, a hand sweeps the ring clearing set bits and evicts the
+    // first entry that wasn't referenced since the hand last passed it.
+    // Lookups only set a bit, which is cheaper than LRU's reordering.
+    template <typename Key, typename Value>
+    class ClockCache {
+     private:
+      struct Slot {
+        Key key;
+        Value value;
+        bool referenced;
+      };
+      std::size_t capacity_;
+      std::vector<Slot> slots_;
+      std::unordered_map<Key, std::size_t, TupleHash> index_;
+      std::size_t hand_{};
+
+     public:
+      explicit ClockCache(std::size_t capacity) : capacity_{capacity} {}
+
+      const Value* find(const Key& key) {
+        auto it = index_.find(key);
+        if (it == index_.end()) {
+          return nullptr;
+        }
+        Slot& slot = slots_[it->second];
+        slot.referenced = true;
+        return &slot.value;
+      }
+
+      void insert(Key key, Value value) {
+        if (capacity_ == 0) {
+          return;
+        }
+        if (slots_.size() < capacity_) {
+          slots_.push_back({std::move(key), std::move(value), false});
+          index_.emplace(slots_.back().key, slots_.size() - 1);
+          return;
+        }
+        while (slots_[hand_].referenced) {
+          slots_[hand_].referenced = false;
+          hand_ = (hand_ + 1) % capacity_;
+        }
+        index_.erase(slots_[hand_].key);
+        slots_[hand_] = {std::move(key), std::move(value), false};
+        index_.emplace(slots_[hand_].key, hand_);
+        hand_ = (hand_ + 1) % capacity_;
+      }
+
+      std::size_t size() const {
+        return slots_.size();
+      }
+    };
+
+    struct LruPolicy {
+      std::size_t capacity;
+      template <typename Key, typename Value>
+      using Cache = LruCache<Key, Value>;
+    };
+
+    struct ClockPolicy {
+      std::size_t capacity;
+      template <typename Key, typename Value>
+      using Cache = ClockCache<Key, Value>;
+    };
+
+    template <typename T>
+    struct IsCachePolicy : std::false_type {};
+
+    template <>
+    struct IsCachePolicy<LruPolicy> : std::true_type {};
+
+    template <>
+    struct IsCachePolicy<ClockPolicy> : std::true_type {};
+
+    // Wraps the function passed to memo_imap, looking each tuple of
+    // arguments up in the cache before calling it
+    template <typename MapFunc, typename Cache, typename Key, typename Value>
+    class MemoFunc {
+     private:
+      MapFunc map_func_;
+      Cache cache_;
+
+     public:
+      MemoFunc(MapFunc map_func, std::size_t capacity)
+          : map_func_(std::move(map_func)), cache_(capacity) {}
+
+      template <typename... Args>
+      Value operator()(Args&&... args) {
+        Key key{args...};
+        if (const Value* cached = cache_.find(key)) {
+          return *cached;
+        }
+        Value value = std::invoke(map_func_, std::forward<Args>(args)...);
+        cache_.insert(std::move(key), value);
+        return value;
+      }
+    };
+
+    struct MemoIMapFn;
+  }
+}
+
+struct iter::impl::MemoIMapFn : PipeableAndBindFirst<MemoIMapFn> {
+ private:
+  template <typename MapFunc, typename Policy, typename TupleType,
+      std::size_t... Is>
+  auto memo_imap_impl(MapFunc map_func, Policy policy, TupleType&& containers,
+      std::index_sequence<Is...>) const {
+    using Containers = std::remove_reference_t<TupleType>;
+    using Key = std::tuple<std::decay_t<
+        iterator_deref<std::tuple_element_t<Is, Containers>>>...>;
+    using Value = std::decay_t<std::invoke_result_t<MapFunc&,
+        iterator_deref<std::tuple_element_t<Is, Containers>>...>>;
+    using Memo = MemoFunc<MapFunc,
+        typename Policy::template Cache<Key, Value>, Key, Value>;
+    return IMapFn{}(Memo{std::move(map_func), policy.capacity},
+        std::forward<std::tuple_element_t<Is, Containers>>(
+            std::get<Is>(containers))...);
+  }
+
+  // memo_imap(f, policy), to have the iterable passed later via pipe
+  template <typename MapFunc, typename Policy>
+  struct FnPartialWithPolicy : Pipeable<FnPartialWithPolicy<MapFunc, Policy>> {
+    mutable MapFunc map_func;
+    Policy policy;
+
+    template <typename Container>
+    auto operator()(Container&& container) const {
+      return MemoIMapFn{}(
+          map_func, std::forward<Container>(container), policy);
+    }
+  };
+
+ public:
+  static constexpr std::size_t DEFAULT_CAPACITY = 1024;
+
+  // The last argument may be a cache policy from iter::lru_cache() or
+  // iter::clock_cache(), otherwise an LRU cache of DEFAULT_CAPACITY is used
+  template <typename MapFunc, typename Container, typename... Args,
+      typename = std::enable_if_t<
+          !IsCachePolicy<std::decay_t<Container>>::value>>
+  auto operator()(
+      MapFunc map_func, Container&& container, Args&&... args) const {
+    auto arg_tup = std::forward_as_tuple(
+        std::forward<Container>(container), std::forward<Args>(args)...);
+    constexpr std::size_t last = sizeof...(Args);
+    using LastArg = std::decay_t<std::tuple_element_t<last, decltype(arg_tup)>>;
+    if constexpr (IsCachePolicy<LastArg>::value) {
+      return memo_imap_impl(std::move(map_func), std::get<last>(arg_tup),
+          std::move(arg_tup), std::make_index_sequence<last>{});
+    } else {
+      return memo_imap_impl(std::move(map_func), LruPolicy{DEFAULT_CAPACITY},
+          std::move(arg_tup), std::make_index_sequence<last + 1>{});
+    }
+  }
+
+  template <typename MapFunc, typename Policy,
+      typename = std::enable_if_t<IsCachePolicy<Policy>::value>>
+  FnPartialWithPolicy<MapFunc, Policy> operator()(
+      MapFunc map_func, Policy policy) const {
+    return {{}, std::move(map_func), policy};
+  }
+
+  using PipeableAndBindFirst<MemoIMapFn>::operator();
+};
+
+namespace iter {
+  constexpr impl::MemoIMapFn memo_imap{};
+
+  // cache policies for memo_imap
+  constexpr impl::LruPolicy lru_cache(std::size_t capacity) {
+    return {capacity};
+  }
+
+  constexpr impl::ClockPolicy clock_cache(std::size_t capacity) {
+    return {capacity};
+  }
+}
+
+#endif
@@ -0,0 +1,192 @@
+#ifndef ITER_PREFETCHED_HPP_
+#define ITER_PREFETCHED_HPP_
+
+#include "internal/iterator_wrapper.hpp"
+#include "internal/iterbase.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+namespace iter {
+  namespace impl {
+    template <typename Container, typename Projection>
+    class Prefetched;
+
+    // default projection for prefetched, prefetches the element itself
+    struct PrefetchElement {};
+
+    struct PrefetchedFn;
+  }
+}
+
+// Yields the same elements as the container, while a second iterator runs
+// `distance` elements ahead and prefetches the element it refers to, or
+// the pointer the projection returns for it.  The look ahead needs to go
+// over the elements a second time, so elements of single-pass iterables are
+// passed straight through without any prefetching.
+template <typename Container, typename Projection>
+class iter::impl::Prefetched {
+ private:
+  Container container_;
+  mutable Projection projection_;
+  std::size_t distance_;
+
+  friend PrefetchedFn;
+
+  Prefetched(
+      Container&& container, std::size_t distance, Projection projection)
+      : container_(std::forward<Container>(container)),
+        projection_(std::move(projection)),
+        distance_{distance} {}
+
+ public:
+  Prefetched(Prefetched&&) = default;
+
+  template <typename ContainerT>
+  class Iterator {
+   private:
+    template <typename>
+    friend class Iterator;
+    static constexpr bool looks_ahead =
+        is_forward_iter<iterator_type<ContainerT>>::value;
+    using AheadIter = std::conditional_t<looks_ahead,
+        IteratorWrapper<ContainerT>, std::nullptr_t>;
+
+    IteratorWrapper<ContainerT> sub_iter_;
+    AheadIter ahead_iter_;
+    IteratorWrapper<ContainerT> sub_end_;
+    Projection* projection_;
+
+    static AheadIter make_ahead_iter(const IteratorWrapper<ContainerT>& it) {
+      if constexpr (looks_ahead) {
+        return it;
+      } else {
+        return nullptr;
+      }
+    }
+
+    void prefetch_ahead() {
+      if constexpr (!looks_ahead) {
+        return;
+      } else if (ahead_iter_ != sub_end_) {
+        if constexpr (std::is_same_v<Projection, PrefetchElement>) {
+          prefetch_deref(ahead_iter_);
+        } else {
+          prefetch(std::invoke(*projection_, *ahead_iter_));
+        }
+        ++ahead_iter_;
+      }
+    }
+
+   public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = iterator_traits_deref<ContainerT>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = value_type*;
+    using reference = value_type&;
+
+    Iterator(IteratorWrapper<ContainerT>&& sub_iter,
+        IteratorWrapper<ContainerT>&& sub_end, Projection& projection,
+        std::size_t distance)
+        : sub_iter_{std::move(sub_iter)},
+          ahead_iter_{make_ahead_iter(sub_iter_)},
+          sub_end_{std::move(sub_end)},
+          projection_(&projection) {
+      for (std::size_t i = 0; i < distance; ++i) {
+        prefetch_ahead();
+      }
+    }
+
+    iterator_deref<ContainerT> operator*() {
+      return *sub_iter_;
+    }
+
+    iterator_arrow<ContainerT> operator->() {
+      return apply_arrow(sub_iter_);
+    }
+
+    Iterator& operator++() {
+      prefetch_ahead();
+      ++sub_iter_;
+      return *this;
+    }
+
+    Iterator operator++(int) {
+      auto ret = *this;
+      ++*this;
+      return ret;
+    }
+
+    template <typename T>
+    bool operator!=(const Iterator<T>& other) const {
+      return sub_iter_ != other.sub_iter_;
+    }
+
+    template <typename T>
+    bool operator==(const Iterator<T>& other) const {
+      return !(*this != other);
+    }
+  };
+
+  Iterator<Container> begin() {
+    return {get_begin(container_), get_end(container_), projection_,
+        distance_};
+  }
+
+  Iterator<Container> end() {
+    return {get_end(container_), get_end(container_), projection_, 0};
+  }
+
+  Iterator<AsConst<Container>> begin() const {
+    return {get_begin(std::as_const(container_)),
+        get_end(std::as_const(container_)), projection_, distance_};
+  }
+
+  Iterator<AsConst<Container>> end() const {
+    return {get_end(std::as_const(container_)),
+        get_end(std::as_const(container_)), projection_, 0};
+  }
+
+  template <typename T = Container, typename = std::enable_if_t<has_size<T>>>
+  std::size_t size() const {
+    return std::size(container_);
+  }
+};
+
+struct iter::impl::PrefetchedFn : Pipeable<PrefetchedFn> {
+ private:
+  struct FnPartial : Pipeable<FnPartial> {
+    std::size_t distance;
+    constexpr FnPartial(std::size_t in_distance) : distance{in_distance} {}
+
+    template <typename Container>
+    auto operator()(Container&& container) const {
+      return PrefetchedFn{}(std::forward<Container>(container), distance);
+    }
+  };
+
+ public:
+  static constexpr std::size_t DEFAULT_DISTANCE = 8;
+
+  template <typename Container, typename Projection = PrefetchElement,
+      typename = std::enable_if_t<is_iterable<Container>>>
+  Prefetched<Container, Projection> operator()(Container&& container,
+      std::size_t distance = DEFAULT_DISTANCE,
+      Projection projection = {}) const {
+    return {std::forward<Container>(container), distance,
+        std::move(projection)};
+  }
+
+  FnPartial operator()(std::size_t distance) const {
+    return {distance};
+  }
+};
+
+namespace iter {
+  constexpr impl::PrefetchedFn prefetched{};
+}
+
+#endif
@@ -0,0 +1,241 @@
+#ifndef ITER_REDUCE_HPP_
+#define ITER_REDUCE_HPP_
+
+#include "imap.hpp"
+#include "internal/iterbase.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace iter {
+  // is_associative_op<F> says whether reduce may regroup and reorder
+  // applications of F over arithmetic values, keeping several partial
+  // results and combining them at the end.  Holds for the standard
+  // arithmetic and bitwise function objects, iter::minimum and
+  // iter::maximum, and for any F with a member type named is_associative.
+  // It may be specialized as std::true_type for other function objects.
+  template <typename F, typename = void>
+  struct is_associative_op : std::false_type {};
+
+  template <typename F>
+  struct is_associative_op<F, std::void_t<typename F::is_associative>>
+      : std::true_type {};
+
+  template <typename T>
+  struct is_associative_op<std::plus<T>> : std::true_type {};
+
+  template <typename T>
+  struct is_associative_op<std::multiplies<T>> : std::true_type {};
+
+  template <typename T>
+  struct is_associative_op<std::bit_and<T>> : std::true_type {};
+
+  template <typename T>
+  struct is_associative_op<std::bit_or<T>> : std::true_type {};
+
+  template <typename T>
+  struct is_associative_op<std::bit_xor<T>> : std::true_type {};
+
+  namespace impl {
+    // the lesser of two values, the first if neither is less
+    struct MinimumFn {
+      using is_associative = void;
+
+      template <typename T, typename U>
+      constexpr std::common_type_t<T, U> operator()(
+          const T& lhs, const U& rhs) const {
+        if (rhs < lhs) {
+          return rhs;
+        }
+        return lhs;
+      }
+    };
+
+    // the greater of two values, the first if neither is greater
+    struct MaximumFn {
+      using is_associative = void;
+
+      template <typename T, typename U>
+      constexpr std::common_type_t<T, U> operator()(
+          const T& lhs, const U& rhs) const {
+        if (lhs < rhs) {
+          return rhs;
+        }
+        return lhs;
+      }
+    };
+
+    // IsProductIMap<C> if C is imap(std::multiplies, a, b) over contiguous
+    // iterables of arithmetic values, which reduce can sum with a fused
+    // multiply-add
+    template <typename Container>
+    struct IsProductIMap : std::false_type {};
+
+    template <typename T, typename A, typename B>
+    struct IsProductIMap<IMapper<std::multiplies<T>, std::tuple<A, B>, 0, 1>>
+        : std::bool_constant<is_contiguous<A> && is_contiguous<B>
+                             && std::is_arithmetic_v<std::remove_reference_t<
+                                 iterator_deref<A>>>
+                             && std::is_arithmetic_v<std::remove_reference_t<
+                                 iterator_deref<B>>>> {};
+
+    template <typename F>
+    struct IsPlus : std::false_type {};
+
+    template <typename T>
+    struct IsPlus<std::plus<T>> : std::true_type {};
+
+    struct ReduceFn;
+  }
+
+  constexpr impl::MinimumFn minimum{};
+  constexpr impl::MaximumFn maximum{};
+}
+
+struct iter::impl::ReduceFn : Pipeable<ReduceFn> {
+ private:
+  // number of independent partial results kept by the contiguous kernels.
+  // Splitting the fold this way removes the dependency of each step on the
+  // one before it, which is what lets compilers vectorize the loop.  It also
+  // changes the order the values are combined in, so a floating point
+  // result may differ slightly from a strict left to right fold.
+  static constexpr std::size_t LANES = 8;
+
+  template <typename Container, typename ReduceFunc>
+  using ReduceVal = std::remove_reference_t<std::invoke_result_t<ReduceFunc,
+      iterator_deref<Container>, iterator_deref<Container>>>;
+
+  template <typename Container, typename ReduceFunc>
+  static constexpr bool use_lanes =
+      is_contiguous<Container>
+      && std::is_arithmetic_v<
+          std::remove_reference_t<iterator_deref<Container>>>
+      && std::is_arithmetic_v<ReduceVal<Container, ReduceFunc>>
+      && is_associative_op<ReduceFunc>::value;
+
+  // The products are computed in the sum's type, so this is only done when
+  // that's the type imap's multiplies gives them in.  Otherwise, like
+  // multiplies<int> over doubles, the serial fold would convert them
+  template <typename Container, typename ReduceFunc>
+  static constexpr bool use_fma_lanes =
+      IsProductIMap<std::decay_t<Container>>::value
+      && std::is_arithmetic_v<ReduceVal<Container, ReduceFunc>>
+      && std::is_same_v<std::decay_t<iterator_deref<Container>>,
+             ReduceVal<Container, ReduceFunc>>
+      && IsPlus<ReduceFunc>::value;
+
+  // x * y + z, in one operation where the target has one that's fast
+  template <typename T>
+  static T multiply_add(T x, T y, T z) {
+#if defined(FP_FAST_FMA) && defined(FP_FAST_FMAF)
+    if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>) {
+      return std::fma(x, y, z);
+    }
+#endif
+    return x * y + z;
+  }
+
+  // sum of a[i] * b[i] for i < size, with size >= LANES
+  template <typename T, typename A, typename B>
+  static T dot_lanes(const A* a, const B* b, std::size_t size) {
+    T lanes[LANES];
+    for (std::size_t j = 0; j < LANES; ++j) {
+      lanes[j] = static_cast<T>(a[j]) * static_cast<T>(b[j]);
+    }
+    std::size_t i = LANES;
+    for (; i + LANES <= size; i += LANES) {
+      for (std::size_t j = 0; j < LANES; ++j) {
+        lanes[j] = multiply_add<T>(a[i + j], b[i + j], lanes[j]);
+      }
+    }
+    T result = lanes[0];
+    for (std::size_t j = 1; j < LANES; ++j) {
+      result += lanes[j];
+    }
+    for (; i < size; ++i) {
+      result = multiply_add<T>(a[i], b[i], result);
+    }
+    return result;
+  }
+
+  template <typename T, typename ReduceFunc, typename Elem>
+  static T reduce_lanes(const Elem* data, std::size_t size, ReduceFunc& func) {
+    T lanes[LANES];
+    for (std::size_t j = 0; j < LANES; ++j) {
+      lanes[j] = data[j];
+    }
+    std::size_t i = LANES;
+    for (; i + LANES <= size; i += LANES) {
+      for (std::size_t j = 0; j < LANES; ++j) {
+        lanes[j] = func(lanes[j], data[i + j]);
+      }
+    }
+    T result = lanes[0];
+    for (std::size_t j = 1; j < LANES; ++j) {
+      result = func(result, lanes[j]);
+    }
+    for (; i < size; ++i) {
+      result = func(result, data[i]);
+    }
+    return result;
+  }
+
+  template <typename T>
+  struct FnPartial : Pipeable<FnPartial<T>> {
+    mutable T stored_arg;
+    constexpr FnPartial(T in_t) : stored_arg(in_t) {}
+
+    template <typename Container>
+    auto operator()(Container&& container) const {
+      return ReduceFn{}(std::forward<Container>(container), stored_arg);
+    }
+  };
+
+ public:
+  template <typename Container, typename ReduceFunc = std::plus<>,
+      typename = std::enable_if_t<is_iterable<Container>>>
+  std::optional<ReduceVal<Container, ReduceFunc>> operator()(
+      Container&& container, ReduceFunc reduce_func = {}) const {
+    using T = ReduceVal<Container, ReduceFunc>;
+    if constexpr (use_lanes<Container, ReduceFunc>) {
+      const std::size_t size = std::size(container);
+      if (size >= LANES) {
+        return reduce_lanes<T>(std::data(container), size, reduce_func);
+      }
+    } else if constexpr (use_fma_lanes<Container, ReduceFunc>) {
+      const std::size_t size = std::size(container);
+      if (size >= LANES) {
+        return dot_lanes<T>(std::data(std::get<0>(container.containers_)),
+            std::data(std::get<1>(container.containers_)), size);
+      }
+    }
+    auto it = get_begin(container);
+    auto end_it = get_end(container);
+    if (!(it != end_it)) {
+      return std::nullopt;
+    }
+    std::optional<T> result{*it};
+    for (++it; it != end_it; ++it) {
+      *result = std::invoke(reduce_func, *result, *it);
+    }
+    return result;
+  }
+
+  template <typename ReduceFunc,
+      typename = std::enable_if_t<!is_iterable<ReduceFunc>>>
+  FnPartial<std::decay_t<ReduceFunc>> operator()(
+      ReduceFunc&& reduce_func) const {
+    return {std::forward<ReduceFunc>(reduce_func)};
+  }
+};
+
+namespace iter {
+  constexpr impl::ReduceFn reduce{};
+}
+
+#endif
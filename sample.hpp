@@ -0,0 +1,100 @@
+#ifndef ITER_SAMPLE_HPP_
+#define ITER_SAMPLE_HPP_
+
+#include "internal/iterbase.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <random>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace iter {
+  namespace impl {
+    struct SampleFn;
+  }
+}
+
+// sample picks k elements uniformly at random from an iterable of unknown
+// length in a single pass, into a std::vector, using reservoir sampling
+// with Algorithm L (Li, 1994).  The first k elements fill the reservoir.
+// From then on, rather than drawing a random number for every element to
+// decide whether to keep it, it draws how many elements to pass over
+// before the next one that replaces a random slot of the reservoir, so it
+// takes O(k log(n/k)) random draws.  Random access inputs are skipped over
+// in constant time.  The order of the result is not meaningful.
+struct iter::impl::SampleFn : Pipeable<SampleFn> {
+ private:
+  struct FnPartial : Pipeable<FnPartial> {
+    std::size_t k;
+    std::uint64_t seed;
+
+    template <typename Container>
+    auto operator()(Container&& container) const {
+      return SampleFn{}(std::forward<Container>(container), k, seed);
+    }
+  };
+
+ public:
+  template <typename Container,
+      typename = std::enable_if_t<is_iterable<Container>>>
+  auto operator()(
+      Container&& container, std::size_t k, std::uint64_t seed = 1) const {
+    std::vector<std::decay_t<iterator_deref<Container>>> reservoir;
+    if (k == 0) {
+      return reservoir;
+    }
+    if constexpr (has_size<Container>) {
+      reservoir.reserve(std::min<std::size_t>(k, std::size(container)));
+    }
+
+    auto it = get_begin(container);
+    auto end_it = get_end(container);
+    for (; reservoir.size() < k && it != end_it; ++it) {
+      reservoir.emplace_back(*it);
+    }
+    if (!(it != end_it)) {
+      return reservoir;
+    }
+
+    std::mt19937_64 gen{seed};
+    std::uniform_real_distribution<double> unit{0.0, 1.0};
+    // in (0, 1], so its log is finite
+    auto draw = [&gen, &unit] { return 1.0 - unit(gen); };
+    std::uniform_int_distribution<std::size_t> slot{0, k - 1};
+    const double k_d = static_cast<double>(k);
+
+    double w = std::exp(std::log(draw()) / k_d);
+    while (true) {
+      const double skip = std::floor(std::log(draw()) / std::log1p(-w));
+      // a skip too big to count means the end will be reached first
+      constexpr double max_skip =
+          static_cast<double>(std::numeric_limits<std::size_t>::max() / 2);
+      dumb_advance(it, end_it,
+          skip < max_skip ? static_cast<std::size_t>(skip)
+                          : std::numeric_limits<std::size_t>::max() / 2);
+      if (!(it != end_it)) {
+        break;
+      }
+      reservoir[slot(gen)] = *it;
+      ++it;
+      w *= std::exp(std::log(draw()) / k_d);
+    }
+    return reservoir;
+  }
+
+  FnPartial operator()(std::size_t k, std::uint64_t seed = 1) const {
+    return {{}, k, seed};
+  }
+};
+
+namespace iter {
+  constexpr impl::SampleFn sample{};
+}
+
+#endif
@@ -0,0 +1,231 @@
+#ifndef ITER_SAMPLE_INDICES_HPP_
+#define ITER_SAMPLE_INDICES_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <random>
+
+namespace iter {
+  namespace impl {
+    // Vitter's method D ("An Efficient Algorithm for Sequential Random
+    // Sampling", 1987) for choosing k of n indices in increasing order.
+    // Each call to next_skip() gives how many indices to pass over before
+    // the next one chosen.  It takes O(k) random draws on average however
+    // big n is.  When k is a large fraction of what is left, method D's
+    // rejection step stops paying for itself and the simpler method A,
+    // which walks the skipped indices, is used for the rest.
+    class SequentialSampler {
+     private:
+      // method A is used once fewer than ALPHA indices are left per pick
+      static constexpr std::uint64_t ALPHA = 13;
+
+      std::mt19937_64 gen_;
+      std::uniform_real_distribution<double> unit_{0.0, 1.0};
+      // indices left to choose, and left to choose them from
+      std::uint64_t k_;
+      std::uint64_t n_;
+      // method D's carried-over V', a uniform variate raised to 1/k_
+      double v_prime_{};
+      // once method A takes over it is used for the rest
+      bool use_a_{};
+
+      // in (0, 1], so its log is finite
+      double draw() {
+        return 1.0 - unit_(gen_);
+      }
+
+      std::uint64_t skip_a() {
+        const double v = draw();
+        double top = static_cast<double>(n_ - k_);
+        double n_real = static_cast<double>(n_);
+        std::uint64_t s = 0;
+        double quot = top / n_real;
+        while (quot > v) {
+          ++s;
+          top -= 1.0;
+          n_real -= 1.0;
+          quot *= top / n_real;
+        }
+        return s;
+      }
+
+      std::uint64_t skip_d() {
+        const double n_real = static_cast<double>(n_);
+        const double k_inv = 1.0 / static_cast<double>(k_);
+        const double k_min1_inv = 1.0 / static_cast<double>(k_ - 1);
+        // one more than the largest skip possible
+        const double qu1 = static_cast<double>(n_ - k_ + 1);
+        while (true) {
+          double x;
+          double s;
+          while (true) {
+            x = n_real * (1.0 - v_prime_);
+            s = std::floor(x);
+            if (s < qu1) {
+              break;
+            }
+            v_prime_ = std::exp(std::log(draw()) * k_inv);
+          }
+          const double u = draw();
+          const double y1 = std::exp(std::log(u * n_real / qu1) * k_min1_inv);
+          v_prime_ = y1 * (1.0 - x / n_real) * (qu1 / (qu1 - s));
+          if (v_prime_ <= 1.0) {
+            // accepted by the cheap test, and v_prime_ can be reused
+            return static_cast<std::uint64_t>(s);
+          }
+          double y2 = 1.0;
+          double top = n_real - 1.0;
+          double bottom;
+          double limit;
+          if (static_cast<double>(k_ - 1) > s) {
+            bottom = n_real - static_cast<double>(k_);
+            limit = n_real - s;
+          } else {
+            bottom = n_real - s - 1.0;
+            limit = qu1;
+          }
+          for (double t = n_real - 1.0; t >= limit; t -= 1.0) {
+            y2 *= top / bottom;
+            top -= 1.0;
+            bottom -= 1.0;
+          }
+          if (n_real / (n_real - x)
+              >= y1 * std::exp(std::log(y2) * k_min1_inv)) {
+            v_prime_ = std::exp(std::log(draw()) * k_min1_inv);
+            return static_cast<std::uint64_t>(s);
+          }
+          v_prime_ = std::exp(std::log(draw()) * k_inv);
+        }
+      }
+
+     public:
+      SequentialSampler(std::uint64_t n, std::uint64_t k, std::uint64_t seed)
+          : gen_{seed}, k_{std::min(k, n)}, n_{n} {
+        if (k_ > 0) {
+          v_prime_ = std::exp(std::log(draw()) / static_cast<double>(k_));
+        }
+      }
+
+      std::uint64_t remaining() const {
+        return k_;
+      }
+
+      // must only be called while remaining() > 0
+      std::uint64_t next_skip() {
+        std::uint64_t s;
+        if (k_ > 1 && !use_a_ && n_ / k_ >= ALPHA) {
+          s = skip_d();
+        } else if (k_ > 1) {
+          use_a_ = true;
+          s = skip_a();
+        } else {
+          // the last one is uniform over what's left
+          const double v = use_a_ ? unit_(gen_) : 1.0 - v_prime_;
+          s = std::min(static_cast<std::uint64_t>(
+                           std::floor(static_cast<double>(n_) * v)),
+              n_ - 1);
+        }
+        n_ -= s + 1;
+        --k_;
+        return s;
+      }
+    };
+
+    class SampledIndices;
+  }
+
+  // Yields k distinct indices chosen uniformly at random from [0, n), in
+  // increasing order.  All of them if k >= n.
+  inline impl::SampledIndices sample_indices(
+      std::size_t n, std::size_t k, std::uint64_t seed = 1);
+}
+
+class iter::impl::SampledIndices {
+ private:
+  std::size_t n_;
+  std::size_t k_;
+  std::uint64_t seed_;
+
+  friend SampledIndices iter::sample_indices(
+      std::size_t, std::size_t, std::uint64_t);
+
+  SampledIndices(std::size_t n, std::size_t k, std::uint64_t seed)
+      : n_{n}, k_{std::min(k, n)}, seed_{seed} {}
+
+ public:
+  class Iterator {
+   private:
+    SequentialSampler sampler_;
+    // the index yielded, or one past the last one chosen so far
+    std::size_t index_{};
+    bool done_;
+
+   public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const value_type*;
+    using reference = const value_type&;
+
+    // the end iterator is made with k of 0
+    Iterator(std::size_t n, std::size_t k, std::uint64_t seed)
+        : sampler_{n, k, seed}, done_{sampler_.remaining() == 0} {
+      if (!done_) {
+        index_ = static_cast<std::size_t>(sampler_.next_skip());
+      }
+    }
+
+    const std::size_t& operator*() const {
+      return index_;
+    }
+
+    const std::size_t* operator->() const {
+      return &index_;
+    }
+
+    Iterator& operator++() {
+      if (sampler_.remaining() == 0) {
+        done_ = true;
+      } else {
+        index_ += static_cast<std::size_t>(sampler_.next_skip()) + 1;
+      }
+      return *this;
+    }
+
+    Iterator operator++(int) {
+      auto ret = *this;
+      ++*this;
+      return ret;
+    }
+
+    bool operator!=(const Iterator& other) const {
+      return done_ != other.done_ || (!done_ && index_ != other.index_);
+    }
+
+    bool operator==(const Iterator& other) const {
+      return !(*this != other);
+    }
+  };
+
+  Iterator begin() const {
+    return {n_, k_, seed_};
+  }
+
+  Iterator end() const {
+    return {n_, 0, seed_};
+  }
+
+  std::size_t size() const {
+    return k_;
+  }
+};
+
+inline iter::impl::SampledIndices iter::sample_indices(
+    std::size_t n, std::size_t k, std::uint64_t seed) {
+  return {n, k, seed};
+}
+
+#endif
@@ -0,0 +1,148 @@
+#ifndef ITER_SCAN_HPP_
+#define ITER_SCAN_HPP_
+
+#include "internal/iterbase.hpp"
+#include "internal/parallel.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace iter {
+  namespace impl {
+    struct ScanFn;
+  }
+}
+
+// scan computes the same running results as accumulate, but all at once,
+// into a std::vector.  Sized random access inputs that are large enough are
+// split into one block per thread and scanned in two passes:
+//   1) each thread scans its own block
+//   2) the last value of each block is folded into an offset for each of
+//      the following blocks, then each thread combines its block with its
+//      offset
+// This requires that the function is associative.
+struct iter::impl::ScanFn : Pipeable<ScanFn> {
+ private:
+  template <typename Container, typename ScanFunc>
+  using ScanVal = std::remove_reference_t<std::invoke_result_t<ScanFunc,
+      iterator_deref<Container>, iterator_deref<Container>>>;
+
+  // The parallel scan fills in its results out of order, so it needs a
+  // result type that can be default constructed and then assigned to.
+  // std::vector<bool> packs its elements into shared words, so threads
+  // writing neighbouring blocks would race
+  template <typename Container, typename ScanFunc>
+  static constexpr bool can_scan_parallel =
+      is_indexable<Container>
+      && std::is_default_constructible_v<ScanVal<Container, ScanFunc>>
+      && std::is_move_assignable_v<ScanVal<Container, ScanFunc>>
+      && !std::is_same_v<std::remove_cv_t<ScanVal<Container, ScanFunc>>,
+             bool>;
+
+  template <typename Container, typename ScanFunc>
+  static std::vector<ScanVal<Container, ScanFunc>> scan_sequential(
+      Container& container, ScanFunc& scan_func) {
+    std::vector<ScanVal<Container, ScanFunc>> result;
+    if constexpr (has_size<Container>) {
+      result.reserve(std::size(container));
+    }
+    auto end_it = get_end(container);
+    for (auto it = get_begin(container); it != end_it; ++it) {
+      if (result.empty()) {
+        result.emplace_back(*it);
+      } else {
+        result.emplace_back(std::invoke(scan_func, result.back(), *it));
+      }
+    }
+    return result;
+  }
+
+  template <typename Container, typename ScanFunc>
+  static std::vector<ScanVal<Container, ScanFunc>> scan_parallel(
+      Container& container, ScanFunc& scan_func, std::size_t num_blocks) {
+    const std::size_t size = std::size(container);
+    const std::size_t block_size = (size + num_blocks - 1) / num_blocks;
+    // rounding up the block size can leave the last blocks empty
+    num_blocks = (size + block_size - 1) / block_size;
+    std::vector<ScanVal<Container, ScanFunc>> result(size);
+    auto first = get_begin(container);
+
+    // first pass, scan each block on its own
+    run_parallel(num_blocks, [&](std::size_t b) {
+      const std::size_t start = b * block_size;
+      const std::size_t stop = std::min(start + block_size, size);
+      auto it = first + static_cast<std::ptrdiff_t>(start);
+      result[start] = *it;
+      for (std::size_t i = start + 1; i < stop; ++i) {
+        ++it;
+        result[i] = std::invoke(scan_func, result[i - 1], *it);
+      }
+    });
+
+    // offsets[b] combines everything before block b
+    std::vector<ScanVal<Container, ScanFunc>> offsets(num_blocks);
+    offsets[1] = result[block_size - 1];
+    for (std::size_t b = 2; b < num_blocks; ++b) {
+      offsets[b] = std::invoke(
+          scan_func, offsets[b - 1], result[b * block_size - 1]);
+    }
+
+    // second pass, apply the offsets to every block but the first
+    run_parallel(num_blocks, [&](std::size_t b) {
+      if (b == 0) {
+        return;
+      }
+      const std::size_t start = b * block_size;
+      const std::size_t stop = std::min(start + block_size, size);
+      for (std::size_t i = start; i < stop; ++i) {
+        result[i] = std::invoke(scan_func, offsets[b], result[i]);
+      }
+    });
+    return result;
+  }
+
+  template <typename T>
+  struct FnPartial : Pipeable<FnPartial<T>> {
+    mutable T stored_arg;
+    constexpr FnPartial(T in_t) : stored_arg(in_t) {}
+
+    template <typename Container>
+    auto operator()(Container&& container) const {
+      return ScanFn{}(std::forward<Container>(container), stored_arg);
+    }
+  };
+
+ public:
+  template <typename Container, typename ScanFunc = std::plus<>,
+      typename = std::enable_if_t<is_iterable<Container>>>
+  std::vector<ScanVal<Container, ScanFunc>> operator()(Container&& container,
+      ScanFunc scan_func = {},
+      std::size_t num_threads = std::thread::hardware_concurrency()) const {
+    if constexpr (can_scan_parallel<Container, ScanFunc>) {
+      const std::size_t num_blocks = std::min<std::size_t>(
+          num_threads, std::size(container) / MIN_PARALLEL_BLOCK_SIZE);
+      if (num_blocks > 1) {
+        return scan_parallel(container, scan_func, num_blocks);
+      }
+    }
+    return scan_sequential(container, scan_func);
+  }
+
+  template <typename ScanFunc,
+      typename = std::enable_if_t<!is_iterable<ScanFunc>>>
+  FnPartial<std::decay_t<ScanFunc>> operator()(ScanFunc&& scan_func) const {
+    return {std::forward<ScanFunc>(scan_func)};
+  }
+};
+
+namespace iter {
+  constexpr impl::ScanFn scan{};
+}
+
+#endif
@@ -4,8 +4,13 @@
 #include "internal/iterator_wrapper.hpp"
 #include "internal/iterbase.hpp"
 
+#include <cassert>
+#include <cstddef>
+#include <deque>
 #include <iterator>
+#include <limits>
 #include <type_traits>
+#include <utility>
 
 namespace iter {
   namespace impl {
@@ -29,22 +34,221 @@ class iter::impl::Sliced {
   Sliced(Container&& container, DifferenceType start, DifferenceType stop,
       DifferenceType step)
       : container_(std::forward<Container>(container)),
-        start_{start < stop && step > 0 ? start : stop},
+        start_{start},
         stop_{stop},
         step_{step} {}
 
+  static constexpr bool is_negative(DifferenceType i) {
+    if constexpr (std::is_signed_v<DifferenceType>) {
+      return i < 0;
+    } else {
+      (void)i;
+      return false;
+    }
+  }
+
+  // start_ and stop_ as positions in an input of length len.  As in Python,
+  // negative ones count back from the end, and both are then clamped to
+  // [0, len].  Empty slices, including any with a step that isn't positive,
+  // have start == stop
+  std::pair<DifferenceType, DifferenceType> bounds(DifferenceType len) const {
+    auto resolve = [len](DifferenceType i) {
+      if (is_negative(i)) {
+        i += len;
+        return is_negative(i) ? DifferenceType{0} : i;
+      }
+      return i < len ? i : len;
+    };
+    const DifferenceType stop = resolve(stop_);
+    const DifferenceType start = resolve(start_);
+    return {start < stop && step_ > 0 ? start : stop, stop};
+  }
+
+  template <typename T>
+  using IteratorBuffer = std::deque<IteratorWrapper<T>>;
+
+  std::size_t count(DifferenceType start, DifferenceType stop) const {
+    return start == stop
+               ? 0
+               : static_cast<std::size_t>((stop - start - 1) / step_ + 1);
+  }
+
  public:
   Sliced(Sliced&&) = default;
+
+  // Sized random access input is sliced by index, so getting to the start,
+  // and moving through the slice, take constant time
+  template <typename ContainerT>
+  class IndexedIterator {
+   private:
+    template <typename>
+    friend class IndexedIterator;
+    // the first element of the slice, which this is index_ steps past
+    iterator_type<ContainerT> first_{};
+    std::ptrdiff_t index_{};
+    std::ptrdiff_t step_{1};
+
+    iterator_type<ContainerT> sub_iter() const {
+      return first_ + index_ * step_;
+    }
+
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = iterator_traits_deref<ContainerT>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = value_type*;
+    using reference = value_type&;
+
+    IndexedIterator() = default;
+
+    IndexedIterator(iterator_type<ContainerT>&& first, std::ptrdiff_t index,
+        std::ptrdiff_t step)
+        : first_(std::move(first)), index_{index}, step_{step} {}
+
+    iterator_deref<ContainerT> operator*() const {
+      return *sub_iter();
+    }
+
+    iterator_arrow<ContainerT> operator->() const {
+      auto it = sub_iter();
+      return apply_arrow(it);
+    }
+
+    iterator_deref<ContainerT> operator[](difference_type n) const {
+      return *(first_ + (index_ + n) * step_);
+    }
+
+    IndexedIterator& operator++() {
+      ++index_;
+      return *this;
+    }
+
+    IndexedIterator operator++(int) {
+      auto ret = *this;
+      ++*this;
+      return ret;
+    }
+
+    IndexedIterator& operator--() {
+      --index_;
+      return *this;
+    }
+
+    IndexedIterator operator--(int) {
+      auto ret = *this;
+      --*this;
+      return ret;
+    }
+
+    IndexedIterator& operator+=(difference_type n) {
+      index_ += n;
+      return *this;
+    }
+
+    IndexedIterator& operator-=(difference_type n) {
+      index_ -= n;
+      return *this;
+    }
+
+    IndexedIterator operator+(difference_type n) const {
+      auto it = *this;
+      it += n;
+      return it;
+    }
+
+    friend IndexedIterator operator+(difference_type n, IndexedIterator it) {
+      it += n;
+      return it;
+    }
+
+    IndexedIterator operator-(difference_type n) const {
+      auto it = *this;
+      it -= n;
+      return it;
+    }
+
+    template <typename T>
+    difference_type operator-(const IndexedIterator<T>& other) const {
+      return index_ - other.index_;
+    }
+
+    template <typename T>
+    bool operator!=(const IndexedIterator<T>& other) const {
+      return index_ != other.index_;
+    }
+
+    template <typename T>
+    bool operator==(const IndexedIterator<T>& other) const {
+      return !(*this != other);
+    }
+
+    template <typename T>
+    bool operator<(const IndexedIterator<T>& other) const {
+      return index_ < other.index_;
+    }
+
+    template <typename T>
+    bool operator>(const IndexedIterator<T>& other) const {
+      return other < *this;
+    }
+
+    template <typename T>
+    bool operator<=(const IndexedIterator<T>& other) const {
+      return !(other < *this);
+    }
+
+    template <typename T>
+    bool operator>=(const IndexedIterator<T>& other) const {
+      return !(*this < other);
+    }
+  };
+
   template <typename ContainerT>
   class Iterator {
    private:
     template <typename>
     friend class Iterator;
+    using Buffer = IteratorBuffer<ContainerT>;
+
     IteratorWrapper<ContainerT> sub_iter_;
     IteratorWrapper<ContainerT> sub_end_;
     DifferenceType current_;
     DifferenceType stop_;
     DifferenceType step_;
+    // Used when the slice was found from the end of an unsized input.  If
+    // lag_ is 0, ahead_ holds iterators to the rest of the slice.
+    // Otherwise the slice stops lag_ elements short of the end, and ahead_
+    // holds iterators to the next lag_ elements, so the slice has ended
+    // when the element after the last of them is the end.
+    bool buffered_{};
+    Buffer ahead_;
+    DifferenceType lag_{};
+
+    void finish() {
+      sub_iter_ = sub_end_;
+      current_ = stop_;
+      ahead_.clear();
+    }
+
+    void advance_buffered() {
+      for (DifferenceType i = 0; i < step_; ++i) {
+        if (lag_ > 0) {
+          auto lead = ahead_.back();
+          ++lead;
+          if (!(lead != sub_end_)) {
+            finish();
+            return;
+          }
+          ahead_.push_back(std::move(lead));
+        }
+        if (ahead_.empty()) {
+          finish();
+          return;
+        }
+        sub_iter_ = std::move(ahead_.front());
+        ahead_.pop_front();
+      }
+    }
 
    public:
     using iterator_category = std::input_iterator_tag;
@@ -62,6 +266,28 @@ class iter::impl::Sliced {
           stop_{stop},
           step_{step} {}
 
+    Iterator(IteratorWrapper<ContainerT>&& sub_iter,
+        IteratorWrapper<ContainerT>&& sub_end, DifferenceType start,
+        DifferenceType stop, DifferenceType step, Buffer&& ahead,
+        DifferenceType lag)
+        : Iterator(std::move(sub_iter), std::move(sub_end), start, stop,
+              step) {
+      buffered_ = true;
+      ahead_ = std::move(ahead);
+      lag_ = lag;
+      if (lag_ > 0 && sub_iter_ != sub_end_) {
+        auto lead = sub_iter_;
+        while (static_cast<DifferenceType>(ahead_.size()) < lag_) {
+          ++lead;
+          if (!(lead != sub_end_)) {
+            finish();
+            break;
+          }
+          ahead_.push_back(lead);
+        }
+      }
+    }
+
     iterator_deref<ContainerT> operator*() {
       return *sub_iter_;
     }
@@ -71,10 +297,14 @@ class iter::impl::Sliced {
     }
 
     Iterator& operator++() {
-      dumb_advance(sub_iter_, sub_end_, step_);
+      if (buffered_) {
+        advance_buffered();
+      } else {
+        dumb_advance(sub_iter_, sub_end_, step_);
+      }
       current_ += step_;
-      if (stop_ < current_) {
-        current_ = stop_;
+      if (!(current_ < stop_)) {
+        finish();
       }
       return *this;
     }
@@ -96,26 +326,116 @@ class iter::impl::Sliced {
     }
   };
 
-  Iterator<Container> begin() {
-    auto it = get_begin(container_);
-    dumb_advance(it, get_end(container_), start_);
-    return {std::move(it), get_end(container_), start_, stop_, step_};
+ private:
+  template <typename ContainerT>
+  using IteratorFor = std::conditional_t<is_indexable<ContainerT>,
+      IndexedIterator<ContainerT>, Iterator<ContainerT>>;
+
+  template <typename ContainerT>
+  IteratorFor<ContainerT> make_begin(ContainerT& container) const {
+    using Buffer = IteratorBuffer<ContainerT>;
+    if constexpr (is_indexable<ContainerT>) {
+      const auto [start, stop] =
+          bounds(static_cast<DifferenceType>(std::size(container)));
+      (void)stop;
+      return {get_begin(container) + static_cast<std::ptrdiff_t>(start), 0,
+          static_cast<std::ptrdiff_t>(step_)};
+    } else if constexpr (has_size<ContainerT>) {
+      const auto [start, stop] =
+          bounds(static_cast<DifferenceType>(std::size(container)));
+      if (start == stop) {
+        return make_end<ContainerT>(container);
+      }
+      auto it = get_begin(container);
+      dumb_advance(it, get_end(container), start);
+      return {std::move(it), get_end(container), start, stop, step_};
+    } else {
+      if (!(step_ > 0)) {
+        return make_end<ContainerT>(container);
+      }
+      if constexpr (!is_forward_iter<iterator_type<ContainerT>>::value) {
+        // counting back from the end means coming back to iterators kept
+        // from earlier in the input, which a single-pass input can't do
+        assert(!is_negative(start_) && !is_negative(stop_)
+               && "slice: negative indices on an input without a size "
+                  "need forward iterators");
+        if (is_negative(start_) || is_negative(stop_)) {
+          return make_end<ContainerT>(container);
+        }
+      } else if (is_negative(start_)) {
+        // count the input, keeping iterators to as many elements at the end
+        // of it as start_ counts back
+        Buffer tail;
+        DifferenceType len{0};
+        for (auto it = get_begin(container); it != get_end(container); ++it) {
+          tail.push_back(
+              IteratorWrapper<ContainerT>{iterator_type<ContainerT>{it}});
+          if (static_cast<DifferenceType>(tail.size()) > -start_) {
+            tail.pop_front();
+          }
+          ++len;
+        }
+        const auto [start, stop] = bounds(len);
+        if (start == stop) {
+          return make_end<ContainerT>(container);
+        }
+        auto first = std::move(tail.front());
+        tail.pop_front();
+        return {std::move(first), get_end(container), start, stop, step_,
+            std::move(tail), 0};
+      }
+      auto it = get_begin(container);
+      dumb_advance(it, get_end(container), start_);
+      if constexpr (is_forward_iter<iterator_type<ContainerT>>::value) {
+        if (is_negative(stop_)) {
+          return {std::move(it), get_end(container), start_,
+              std::numeric_limits<DifferenceType>::max(), step_, Buffer{},
+              -stop_};
+        }
+      }
+      if (!(start_ < stop_)) {
+        return make_end<ContainerT>(container);
+      }
+      return {std::move(it), get_end(container), start_, stop_, step_};
+    }
+  }
+
+  template <typename ContainerT>
+  IteratorFor<ContainerT> make_end(ContainerT& container) const {
+    if constexpr (is_indexable<ContainerT>) {
+      const auto [start, stop] =
+          bounds(static_cast<DifferenceType>(std::size(container)));
+      return {get_begin(container) + static_cast<std::ptrdiff_t>(start),
+          static_cast<std::ptrdiff_t>(count(start, stop)),
+          static_cast<std::ptrdiff_t>(step_)};
+    } else {
+      return {get_end(container), get_end(container), stop_, stop_, step_};
+    }
+  }
+
+ public:
+  IteratorFor<Container> begin() {
+    return make_begin<Container>(container_);
+  }
+
+  IteratorFor<Container> end() {
+    return make_end<Container>(container_);
   }
 
-  Iterator<Container> end() {
-    return {get_end(container_), get_end(container_), stop_, stop_, step_};
+  IteratorFor<AsConst<Container>> begin() const {
+    return make_begin<AsConst<Container>>(std::as_const(container_));
   }
 
-  Iterator<AsConst<Container>> begin() const {
-    auto it = get_begin(std::as_const(container_));
-    dumb_advance(it, get_end(std::as_const(container_)), start_);
-    return {std::move(it), get_end(std::as_const(container_)), start_, stop_,
-        step_};
+  IteratorFor<AsConst<Container>> end() const {
+    return make_end<AsConst<Container>>(std::as_const(container_));
   }
 
-  Iterator<AsConst<Container>> end() const {
-    return {get_end(std::as_const(container_)),
-        get_end(std::as_const(container_)), stop_, stop_, step_};
+  // available when the input works with std::size()
+  template <typename C = Container, typename = std::enable_if_t<has_size<C>>>
+  std::size_t size() const {
+    const auto [start, stop] =
+        bounds(static_cast<DifferenceType>(std::size(container_)));
+    return count(start, stop);
   }
 };
 
@@ -8,4 +8,5 @@ def itertools_tests(progs):
             ":test_main",
             ],
         copts = ["-I.", "-std=c++17", "-Wall", "-Wextra", "-pedantic", "-g"],
+        linkopts = ["-pthread"],
     )
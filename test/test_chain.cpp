@@ -188,6 +188,73 @@ TEST_CASE("chain: has correct ctor and assign ops", "[chain]") {
   REQUIRE(itertest::IsMoveConstructibleOnly<T>::value);
 }
 
+TEST_CASE("chain: contiguous iterables", "[chain]") {
+  std::vector<char> header{'a', 'b'};
+  std::string body{"mno"};
+  char trailer[] = {'x', 'y', 'z'};
+  std::vector<char> emp{};
+
+  SECTION("Basic") {
+    auto ch = chain(header, body, trailer);
+    Vec v(std::begin(ch), std::end(ch));
+    Vec vc{'a', 'b', 'm', 'n', 'o', 'x', 'y', 'z'};
+    REQUIRE(v == vc);
+  }
+
+  SECTION("With empty iterables") {
+    auto ch = chain(emp, header, emp, emp, trailer, emp);
+    Vec v(std::begin(ch), std::end(ch));
+    Vec vc{'a', 'b', 'x', 'y', 'z'};
+    REQUIRE(v == vc);
+  }
+
+  SECTION("Only empty iterables") {
+    auto ch = chain(emp, std::string{});
+    REQUIRE(std::begin(ch) == std::end(ch));
+  }
+
+  SECTION("Modifies underlying elements") {
+    for (auto&& c : chain(header, body)) {
+      c = 'q';
+    }
+    REQUIRE(header == std::vector<char>{'q', 'q'});
+    REQUIRE(body == "qqq");
+  }
+
+  SECTION("const iteration") {
+    const auto ch = chain(header, std::string{"mno"});
+    Vec v(std::begin(ch), std::end(ch));
+    Vec vc{'a', 'b', 'm', 'n', 'o'};
+    REQUIRE(v == vc);
+  }
+}
+
+TEST_CASE("chain: for_each_segment visits each iterable", "[chain]") {
+  std::string s1{"abc"};
+  std::list<char> li{'m', 'n', 'o'};
+  std::vector<char> vec{};
+  auto ch = chain(s1, li, vec);
+
+  std::vector<std::size_t> sizes;
+  std::vector<char> v;
+  ch.for_each_segment([&](auto&& seg) {
+    sizes.push_back(seg.size());
+    v.insert(v.end(), std::begin(seg), std::end(seg));
+  });
+  REQUIRE(sizes == std::vector<std::size_t>{3, 3, 0});
+
+  Vec vc{'a', 'b', 'c', 'm', 'n', 'o'};
+  REQUIRE(v == vc);
+}
+
+TEST_CASE("chain: size()", "[chain]") {
+  std::string s1{"abc"};
+  std::list<char> li{'m', 'n'};
+  char arr[] = {'x', 'y', 'z', 'w'};
+  REQUIRE(chain(s1, li, arr).size() == 9);
+  REQUIRE(chain(std::string{}, std::string{}).size() == 0);
+}
+
 TEST_CASE("chain.from_iterable: basic test", "[chain.from_iterable]") {
   std::vector<std::string> sv{"abc", "xyz"};
   std::vector<char> v;
@@ -305,6 +372,33 @@ TEST_CASE("chain.from_iterable: iterator meets requirements",
   REQUIRE(itertest::IsIterator<decltype(std::begin(c))>::value);
 }
 
+TEST_CASE("chain.from_iterable: for_each_segment visits each iterable",
+    "[chain.from_iterable]") {
+  std::vector<std::vector<int>> ivv{{}, {2, 4, 6}, {}, {8, 10}, {}};
+  auto ch = chain.from_iterable(ivv);
+  std::vector<std::size_t> sizes;
+  std::vector<int> v;
+  ch.for_each_segment([&](auto&& seg) {
+    sizes.push_back(seg.size());
+    v.insert(v.end(), std::begin(seg), std::end(seg));
+  });
+  REQUIRE(sizes == std::vector<std::size_t>{0, 3, 0, 2, 0});
+  REQUIRE(v == std::vector<int>{2, 4, 6, 8, 10});
+}
+
+TEST_CASE("chain.from_iterable: size()", "[chain.from_iterable]") {
+  std::vector<std::string> sv{"abc", "", "de", "", ""};
+  REQUIRE(chain.from_iterable(sv).size() == 5);
+  REQUIRE(chain.from_iterable(std::vector<std::string>{}).size() == 0);
+}
+
+TEST_CASE("chain.from_iterable: only empty subiterables",
+    "[chain.from_iterable]") {
+  std::vector<std::string> sv{"", "", ""};
+  auto ch = chain.from_iterable(sv);
+  REQUIRE(std::begin(ch) == std::end(ch));
+}
+
 template <typename T>
 using ImpT2 = decltype(chain.from_iterable(std::declval<T>()));
 TEST_CASE("chain.from_iterable: has correct ctor and assign ops",
@@ -1,6 +1,8 @@
 #include <compress.hpp>
 #include "helpers.hpp"
 
+#include <bitset>
+#include <cstdint>
 #include <iterator>
 #include <string>
 #include <utility>
@@ -168,3 +170,80 @@ TEST_CASE("compress: has correct ctor and assign ops", "[compress]") {
   REQUIRE(itertest::IsMoveConstructibleOnly<T1>::value);
   REQUIRE(itertest::IsMoveConstructibleOnly<T2>::value);
 }
+
+TEST_CASE("compress: vector<bool> selectors over many words", "[compress]") {
+  std::vector<int> ns;
+  std::vector<bool> bs;
+  for (int i = 0; i < 1000; ++i) {
+    ns.push_back(i);
+    bs.push_back(i % 97 == 0 || (i > 300 && i < 340));
+  }
+  std::vector<int> vc;
+  for (auto n : ns) {
+    if (bs[static_cast<std::size_t>(n)]) {
+      vc.push_back(n);
+    }
+  }
+  auto c = compress(ns, bs);
+  Vec v(std::begin(c), std::end(c));
+  REQUIRE(v == vc);
+  REQUIRE(c.size() == vc.size());
+}
+
+TEST_CASE("compress: bitset selectors", "[compress]") {
+  std::bitset<70> bs;
+  bs.set(1);
+  bs.set(64);
+  bs.set(69);
+  std::vector<int> ns(100);
+  for (std::size_t i = 0; i < ns.size(); ++i) {
+    ns[i] = static_cast<int>(i);
+  }
+
+  auto c = compress(ns, bs);
+  Vec v(std::begin(c), std::end(c));
+  Vec vc{1, 64, 69};
+  REQUIRE(v == vc);
+  REQUIRE(c.size() == 3);
+
+  const auto& cc = c;
+  Vec cv(std::begin(cc), std::end(cc));
+  REQUIRE(cv == vc);
+}
+
+TEST_CASE("compress: bitmask of words", "[compress]") {
+  const std::vector<std::uint64_t> words{0x5, 0x0, 0x8000000000000001};
+  std::vector<int> ns(192);
+  for (std::size_t i = 0; i < ns.size(); ++i) {
+    ns[i] = static_cast<int>(i);
+  }
+
+  SECTION("All bits") {
+    auto c = compress(ns, iter::bitmask(words));
+    Vec v(std::begin(c), std::end(c));
+    Vec vc{0, 2, 128, 191};
+    REQUIRE(v == vc);
+    REQUIRE(c.size() == 4);
+  }
+  SECTION("Fewer bits") {
+    auto c = compress(ns, iter::bitmask(words, 130));
+    Vec v(std::begin(c), std::end(c));
+    Vec vc{0, 2, 128};
+    REQUIRE(v == vc);
+    REQUIRE(c.size() == 3);
+  }
+  SECTION("Shorter data") {
+    auto c = compress(Vec{10, 11, 12}, iter::bitmask(words));
+    Vec v(std::begin(c), std::end(c));
+    Vec vc{10, 12};
+    REQUIRE(v == vc);
+    REQUIRE(c.size() == 2);
+  }
+  SECTION("Unsized data") {
+    BasicIterable<int> bi{10, 11, 12};
+    auto c = compress(bi, iter::bitmask(words));
+    Vec v(std::begin(c), std::end(c));
+    Vec vc{10, 12};
+    REQUIRE(v == vc);
+  }
+}
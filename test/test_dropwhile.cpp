@@ -9,6 +9,7 @@
 #include "catch.hpp"
 
 using iter::dropwhile;
+using iter::dropwhile_partitioned;
 
 using Vec = const std::vector<int>;
 
@@ -197,3 +198,91 @@ TEST_CASE("dropwhile: has correct ctor and assign ops", "[dropwhile]") {
   REQUIRE(itertest::IsMoveConstructibleOnly<T1>::value);
   REQUIRE(itertest::IsMoveConstructibleOnly<T2>::value);
 }
+
+TEST_CASE("dropwhile_partitioned: matches dropwhile on partitioned input",
+    "[dropwhile_partitioned]") {
+  Vec ns = {1, 3, 5, 20, 22, 40};
+  auto tp = dropwhile_partitioned(LessThanValue{10}, ns);
+  Vec v(std::begin(tp), std::end(tp));
+  Vec vc = {20, 22, 40};
+  REQUIRE(v == vc);
+  REQUIRE(tp.size() == vc.size());
+
+  auto tw = dropwhile(LessThanValue{10}, ns);
+  REQUIRE(v == Vec(std::begin(tw), std::end(tw)));
+}
+
+TEST_CASE("dropwhile_partitioned: all true, all false, and empty",
+    "[dropwhile_partitioned]") {
+  Vec all_true = {1, 2, 3};
+  Vec all_false = {10, 20};
+  Vec empty{};
+  for (auto&& ns : {all_true, all_false, empty}) {
+    auto tp = dropwhile_partitioned(LessThanValue{10}, ns);
+    auto tw = dropwhile(LessThanValue{10}, ns);
+    Vec v(std::begin(tp), std::end(tp));
+    REQUIRE(v == Vec(std::begin(tw), std::end(tw)));
+    REQUIRE(tp.size() == v.size());
+  }
+}
+
+TEST_CASE("dropwhile_partitioned: calls the predicate O(log n) times",
+    "[dropwhile_partitioned]") {
+  std::vector<int> ns(1 << 20);
+  for (std::size_t i = 0; i < ns.size(); ++i) {
+    ns[i] = static_cast<int>(i);
+  }
+  int calls = 0;
+  auto tp = dropwhile_partitioned(
+      [&calls](int i) {
+        ++calls;
+        return i < 1000;
+      },
+      ns);
+  REQUIRE(tp.size() == (1 << 20) - 1000);
+  REQUIRE(calls <= 21);
+
+  // the split is only looked for once
+  auto it = std::begin(tp);
+  REQUIRE(*(it + 10) == 1010);
+  REQUIRE(std::end(tp) - it == (1 << 20) - 1000);
+  REQUIRE(calls <= 21);
+}
+
+TEST_CASE("dropwhile_partitioned: const iteration",
+    "[dropwhile_partitioned][const]") {
+  Vec ns = {1, 3, 5, 20, 22, 40};
+  const auto tp = dropwhile_partitioned(LessThanValue{10}, ns);
+  Vec v(std::begin(tp), std::end(tp));
+  Vec vc = {20, 22, 40};
+  REQUIRE(v == vc);
+}
+
+TEST_CASE("dropwhile_partitioned: yields references to the input",
+    "[dropwhile_partitioned]") {
+  std::vector<int> ns = {1, 3, 5, 20, 22, 40};
+  for (auto&& i : dropwhile_partitioned(LessThanValue{10}, ns)) {
+    i = 0;
+  }
+  std::vector<int> vc = {1, 3, 5, 0, 0, 0};
+  REQUIRE(ns == vc);
+}
+
+TEST_CASE("dropwhile_partitioned: works with pipe and owns rvalues",
+    "[dropwhile_partitioned]") {
+  auto tp = std::vector<int>{1, 3, 5, 20, 22, 40}
+            | dropwhile_partitioned(LessThanValue{10});
+  auto moved = std::move(tp);
+  Vec v(std::begin(moved), std::end(moved));
+  Vec vc = {20, 22, 40};
+  REQUIRE(v == vc);
+}
+
+TEST_CASE("dropwhile_partitioned: uses bool conversion without a predicate",
+    "[dropwhile_partitioned]") {
+  Vec ns = {3, 2, 1, 0, 0};
+  auto tp = dropwhile_partitioned(ns);
+  Vec v(std::begin(tp), std::end(tp));
+  Vec vc = {0, 0};
+  REQUIRE(v == vc);
+}
@@ -2,13 +2,16 @@
 
 #include "helpers.hpp"
 
+#include <algorithm>
 #include <iterator>
+#include <list>
 #include <string>
 #include <vector>
 
 #include "catch.hpp"
 
 using iter::filter;
+using iter::filter_batched;
 
 using Vec = const std::vector<int>;
 
@@ -191,6 +194,105 @@ TEST_CASE("filter: Works with different begin and end types", "[filter]") {
   REQUIRE(v == vc);
 }
 
+TEST_CASE("filter: contiguous values are filtered one at a time",
+    "[filter]") {
+  std::vector<int> ns(1000, 0);
+  ns[0] = 1;
+  int calls = 0;
+  auto pred = [&calls](int i) {
+    ++calls;
+    return i != 0;
+  };
+  SECTION("break stops calling the predicate") {
+    for (auto&& i : filter(pred, ns)) {
+      (void)i;
+      break;
+    }
+    REQUIRE(calls == 1);
+  }
+  SECTION("later elements can be changed before they're reached") {
+    int seen = 0;
+    for (auto&& i : filter(pred, ns)) {
+      ++seen;
+      if (seen < 3) {
+        ns[static_cast<std::size_t>(i * 10)] = i + 1;
+      }
+    }
+    REQUIRE(seen == 3);
+  }
+}
+
+TEST_CASE("filter_batched: other iterables are filtered one at a time",
+    "[filter_batched]") {
+  std::list<int> ns = {1, 2, 3, 4, 5, 6};
+  auto f = ns | filter_batched([](int i) { return i % 2 == 0; });
+  Vec v(std::begin(f), std::end(f));
+  Vec vc = {2, 4, 6};
+  REQUIRE(v == vc);
+}
+
+TEST_CASE("filter_batched: postfix increment", "[filter_batched]") {
+  std::vector<int> ns(600);
+  for (std::size_t i = 0; i < ns.size(); ++i) {
+    ns[i] = static_cast<int>(i);
+  }
+  auto f = filter_batched([](int i) { return i % 100 == 0; }, ns);
+  auto it = std::begin(f);
+  REQUIRE(*it++ == 0);
+  REQUIRE(*it++ == 100);
+  REQUIRE(*it == 200);
+}
+
+TEST_CASE("filter_batched: iterator meets requirements", "[filter_batched]") {
+  std::vector<int> ns{};
+  auto c = filter_batched([](int) { return true; }, ns);
+  REQUIRE(itertest::IsIterator<decltype(std::begin(c))>::value);
+}
+
+TEST_CASE("filter_batched: contiguous arithmetic values across blocks",
+    "[filter_batched]") {
+  auto pred = [](int i) { return i % 7 == 3 || i > 990; };
+  for (int n : {0, 1, 255, 256, 257, 600, 1000}) {
+    std::vector<int> ns;
+    for (int i = 0; i < n; ++i) {
+      ns.push_back(i);
+    }
+    std::vector<int> vc;
+    std::copy_if(ns.begin(), ns.end(), std::back_inserter(vc), pred);
+
+    auto f = filter_batched(pred, ns);
+    Vec v(std::begin(f), std::end(f));
+    REQUIRE(v == vc);
+
+    const auto& cf = f;
+    Vec cv(std::begin(cf), std::end(cf));
+    REQUIRE(cv == vc);
+  }
+}
+
+TEST_CASE("filter_batched: contiguous values are yielded by reference",
+    "[filter_batched]") {
+  std::vector<int> ns(1000, 1);
+  ns[700] = 2;
+  for (auto& i : filter_batched([](int i) { return i == 2; }, ns)) {
+    i = 3;
+  }
+  REQUIRE(ns[700] == 3);
+  REQUIRE(std::count(ns.begin(), ns.end(), 1) == 999);
+}
+
+TEST_CASE("filter_batched: contiguous, only the last element passes",
+    "[filter_batched]") {
+  std::vector<double> ns(2000, 0.0);
+  ns.back() = 0.5;
+  auto f = filter_batched(ns);
+  auto it = std::begin(f);
+  REQUIRE(it != std::end(f));
+  REQUIRE(&*it == &ns.back());
+  ++it;
+  REQUIRE_FALSE(it != std::end(f));
+}
+
 TEST_CASE("filter: iterator meets requirements", "[filter]") {
   std::string s{};
   auto c = filter([] { return true; }, s);
@@ -0,0 +1,110 @@
+#include <gather.hpp>
+
+#include "helpers.hpp"
+
+#include <list>
+#include <string>
+#include <vector>
+
+#include "catch.hpp"
+
+using iter::gather;
+using iter::scatter;
+using itertest::BasicIterable;
+
+using Vec = const std::vector<int>;
+
+TEST_CASE("gather: yields elements at each index", "[gather]") {
+  Vec ns{10, 11, 12, 13, 14, 15};
+  std::vector<std::size_t> idx{5, 0, 3, 3, 1};
+  auto g = gather(ns, idx);
+  Vec v(std::begin(g), std::end(g));
+  Vec vc{15, 10, 13, 13, 11};
+  REQUIRE(v == vc);
+  REQUIRE(g.size() == idx.size());
+}
+
+TEST_CASE("gather: prefetch distance doesn't change the result", "[gather]") {
+  std::vector<int> ns;
+  std::vector<int> idx;
+  for (int i = 0; i < 500; ++i) {
+    ns.push_back(i * 2);
+    idx.push_back((i * 37) % 500);
+  }
+  std::vector<int> vc;
+  for (auto i : idx) {
+    vc.push_back(ns[static_cast<std::size_t>(i)]);
+  }
+  for (std::size_t d : {0, 1, 16, 499, 500, 10000}) {
+    auto g = gather(ns, idx, d);
+    Vec v(std::begin(g), std::end(g));
+    REQUIRE(v == vc);
+  }
+}
+
+TEST_CASE("gather: empty indices", "[gather]") {
+  Vec ns{1, 2, 3};
+  auto g = gather(ns, std::vector<int>{});
+  REQUIRE(std::begin(g) == std::end(g));
+}
+
+TEST_CASE("gather: indices don't need to be random access", "[gather]") {
+  Vec ns{10, 11, 12, 13};
+  std::list<int> li{3, 1};
+  auto g = gather(ns, li);
+  Vec v(std::begin(g), std::end(g));
+  REQUIRE(v == Vec{13, 11});
+
+  BasicIterable<int> bi{2, 0};
+  auto g2 = gather(ns, bi);
+  Vec v2(std::begin(g2), std::end(g2));
+  REQUIRE(v2 == Vec{12, 10});
+}
+
+TEST_CASE("gather: yields references to the data", "[gather]") {
+  std::vector<int> ns{1, 2, 3};
+  for (auto&& i : gather(ns, Vec{0, 2})) {
+    i = -i;
+  }
+  REQUIRE(ns == Vec{-1, 2, -3});
+}
+
+TEST_CASE("gather: const iteration and operator->", "[gather][const]") {
+  std::vector<std::string> ss{"a", "bb", "ccc"};
+  const auto g = gather(ss, Vec{2, 0});
+  auto it = std::begin(g);
+  REQUIRE(it->size() == 3);
+  ++it;
+  REQUIRE(*it == "a");
+  ++it;
+  REQUIRE(it == std::end(g));
+}
+
+TEST_CASE("gather: iterator meets requirements", "[gather]") {
+  std::string s{};
+  auto g = gather(s, Vec{});
+  REQUIRE(itertest::IsIterator<decltype(std::begin(g))>::value);
+}
+
+TEST_CASE("scatter: writes values at each index", "[scatter]") {
+  std::vector<int> out(5, 0);
+  scatter(Vec{4, 0, 2}, Vec{1, 2, 3}, out);
+  REQUIRE(out == Vec{2, 0, 3, 0, 1});
+}
+
+TEST_CASE("scatter: stops at the shorter of indices and values",
+    "[scatter]") {
+  std::vector<int> out(4, 0);
+  scatter(Vec{3, 2, 1}, Vec{7, 8}, out, 1);
+  REQUIRE(out == Vec{0, 0, 8, 7});
+  scatter(Vec{0}, Vec{5, 6, 7}, out);
+  REQUIRE(out == Vec{5, 0, 8, 7});
+}
+
+TEST_CASE("scatter: undoes gather", "[scatter]") {
+  Vec ns{10, 20, 30, 40};
+  Vec perm{2, 3, 1, 0};
+  std::vector<int> out(ns.size());
+  scatter(perm, gather(ns, perm), out);
+  REQUIRE(out == ns);
+}
@@ -0,0 +1,148 @@
+#include <group_aggregate.hpp>
+
+#include "helpers.hpp"
+
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "catch.hpp"
+
+using iter::group_aggregate;
+namespace agg = iter::agg;
+
+namespace {
+  struct Order {
+    std::string customer;
+    int amount;
+  };
+
+  const std::vector<Order> orders = {{"bob", 10}, {"amy", 5}, {"bob", 3},
+      {"cat", 7}, {"amy", 20}, {"bob", 1}};
+}
+
+TEST_CASE("group_aggregate: groups unsorted input by key",
+    "[group_aggregate]") {
+  using Result = std::pair<std::string, std::tuple<std::size_t, long long>>;
+  std::vector<Result> results;
+  SECTION("Normal call") {
+    for (auto&& g : group_aggregate(orders, &Order::customer, agg::count(),
+             agg::sum(&Order::amount))) {
+      results.push_back(g);
+    }
+  }
+  SECTION("Pipe") {
+    for (auto&& g : orders | group_aggregate(&Order::customer, agg::count(),
+                                 agg::sum(&Order::amount))) {
+      results.push_back(g);
+    }
+  }
+  SECTION("With expected number of groups") {
+    for (auto&& g : group_aggregate(orders, &Order::customer, agg::count(),
+             agg::sum(&Order::amount), 3)) {
+      results.push_back(g);
+    }
+  }
+
+  const std::vector<Result> rc = {
+      {"bob", {3, 14}}, {"amy", {2, 25}}, {"cat", {1, 7}}};
+  REQUIRE(results == rc);
+}
+
+TEST_CASE("group_aggregate: sums are kept in a wide type",
+    "[group_aggregate]") {
+  std::vector<std::uint8_t> bytes(1000, 200);
+  std::vector<short> shorts(1000, 30000);
+  std::vector<float> floats(3, 0.1f);
+  auto key = [](auto) { return 0; };
+
+  auto b = group_aggregate(bytes, key, agg::sum());
+  REQUIRE(std::get<0>(std::begin(b)->second) == 200000);
+
+  auto s = group_aggregate(shorts, key, agg::sum());
+  REQUIRE(std::get<0>(std::begin(s)->second) == 30000000);
+
+  auto f = group_aggregate(floats, key, agg::sum());
+  using FloatSum = std::decay_t<decltype(std::get<0>(std::begin(f)->second))>;
+  REQUIRE(std::is_same<FloatSum, double>::value);
+
+  SECTION("or the one asked for") {
+    auto u = group_aggregate(bytes, key, agg::sum<unsigned>());
+    auto total = std::get<0>(std::begin(u)->second);
+    REQUIRE(std::is_same<decltype(total), unsigned>::value);
+    REQUIRE(total == 200000u);
+  }
+}
+
+TEST_CASE("group_aggregate: min, max, first, last and fold",
+    "[group_aggregate]") {
+  const std::vector<int> ns = {5, 12, 3, 14, 8, 1, 10, 7};
+  auto g = group_aggregate(ns, [](int i) { return i % 2 == 0; },
+      agg::min(), agg::max(), agg::first(), agg::last(),
+      agg::fold(std::string{}, [](std::string s, int i) {
+        return s + std::to_string(i);
+      }));
+  REQUIRE(g.size() == 2);
+  auto it = std::begin(g);
+  REQUIRE(it->first == false);
+  REQUIRE(it->second == std::make_tuple(1, 7, 5, 7, std::string{"5317"}));
+  ++it;
+  REQUIRE(it->first == true);
+  REQUIRE(it->second == std::make_tuple(8, 14, 12, 10, std::string{"1214810"}));
+  ++it;
+  REQUIRE(it == std::end(g));
+}
+
+TEST_CASE("group_aggregate: calls the key function once per element",
+    "[group_aggregate]") {
+  const std::vector<int> ns = {1, 2, 1, 3, 2, 1};
+  int calls = 0;
+  auto g = group_aggregate(ns,
+      [&calls](int i) {
+        ++calls;
+        return i;
+      },
+      agg::count());
+  REQUIRE(calls == static_cast<int>(ns.size()));
+  REQUIRE(g.size() == 3);
+}
+
+TEST_CASE("group_aggregate: works with many groups", "[group_aggregate]") {
+  std::vector<int> ns;
+  for (int i = 0; i < 10000; ++i) {
+    ns.push_back((i * 7919) % 1000);
+  }
+  auto g = group_aggregate(ns, [](int i) { return i; }, agg::count());
+  REQUIRE(g.size() == 1000);
+  bool all_ten = true;
+  for (auto&& kv : g) {
+    all_ten = all_ten && std::get<0>(kv.second) == 10;
+  }
+  REQUIRE(all_ten);
+}
+
+TEST_CASE("group_aggregate: empty input gives no groups",
+    "[group_aggregate]") {
+  const std::vector<int> ns{};
+  auto g = group_aggregate(ns, [](int i) { return i; }, agg::count());
+  REQUIRE(std::begin(g) == std::end(g));
+}
+
+TEST_CASE("group_aggregate: works with input iterators",
+    "[group_aggregate]") {
+  itertest::InputIterable seq;
+  auto g = group_aggregate(seq, [](int i) { return i < 3; }, agg::count());
+  REQUIRE(g.size() == 2);
+}
+
+TEST_CASE("group_aggregate: works with different begin and end types",
+    "[group_aggregate]") {
+  CharRange cr{'f'};
+  auto g = group_aggregate(cr, [](char c) { return c == 'c'; }, agg::count());
+  REQUIRE(g.size() == 2);
+  REQUIRE(std::get<0>(std::begin(g)->second) == 4);
+}
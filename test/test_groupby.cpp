@@ -1,14 +1,17 @@
 #include <groupby.hpp>
+#include <imap.hpp>
 
 #include "helpers.hpp"
 
 #include <iterator>
+#include <list>
 #include <string>
 #include <vector>
 
 #include "catch.hpp"
 
 using iter::groupby;
+using iter::groupby_sorted;
 
 namespace {
   int length(const std::string& s) {
@@ -369,3 +372,147 @@ TEST_CASE("groupby: has correct ctor and assign ops", "[groupby]") {
   REQUIRE(itertest::IsMoveConstructibleOnly<T1>::value);
   REQUIRE(itertest::IsMoveConstructibleOnly<T2>::value);
 }
+
+TEST_CASE("groupby: calls the key function once per element", "[groupby]") {
+  const std::vector<int> ns = {1, 1, 2, 3, 3, 3, 4};
+  int calls = 0;
+  auto key = [&calls](int i) {
+    ++calls;
+    return i;
+  };
+
+  SECTION("groups used") {
+    for (auto&& gb : groupby(ns, key)) {
+      for (auto&& e : gb.second) {
+        (void)e;
+      }
+    }
+  }
+  SECTION("groups skipped") {
+    for (auto&& gb : groupby(ns, key)) {
+      (void)gb;
+    }
+  }
+  REQUIRE(calls == static_cast<int>(ns.size()));
+}
+
+TEST_CASE("groupby: keys that are references aren't copied", "[groupby]") {
+  using itertest::Point;
+  const std::vector<Point> ps = {{0, 2}, {0, 4}, {1, 3}};
+  auto key = [](const Point& p) -> const int& { return p.x; };
+  std::vector<const int*> key_addrs;
+  for (auto&& gb : groupby(ps, key)) {
+    key_addrs.push_back(&gb.first);
+  }
+  const std::vector<const int*> kc = {&ps[0].x, &ps[2].x};
+  REQUIRE(key_addrs == kc);
+}
+
+TEST_CASE("groupby: works with elements yielded by value", "[groupby]") {
+  const std::vector<int> ns = {1, 1, 2, 3, 3};
+  std::vector<int> keys;
+  std::vector<std::vector<int>> groups;
+  for (auto&& gb : groupby(iter::imap([](int i) { return i; }, ns))) {
+    keys.push_back(gb.first);
+    groups.emplace_back(std::begin(gb.second), std::end(gb.second));
+  }
+  const std::vector<int> kc = {1, 2, 3};
+  const std::vector<std::vector<int>> gc = {{1, 1}, {2}, {3, 3}};
+  REQUIRE(keys == kc);
+  REQUIRE(groups == gc);
+}
+
+TEST_CASE("groupby: groups moved out of the pair keep their key",
+    "[groupby]") {
+  const std::vector<int> ns = {1, 1, 2, 3, 3, 3};
+  auto g = groupby(ns, [](int i) { return std::to_string(i); });
+  auto it = std::begin(g);
+  using GroupT = std::decay_t<decltype(it->second)>;
+  std::vector<GroupT> stored;
+  std::vector<std::vector<int>> groups;
+  while (it != std::end(g)) {
+    stored.push_back(std::move(it->second));
+    ++it;  // destroys the pair the group came from
+    groups.emplace_back(std::begin(stored.back()), std::end(stored.back()));
+  }
+  const std::vector<std::vector<int>> gc = {{1, 1}, {2}, {3, 3, 3}};
+  REQUIRE(groups == gc);
+}
+
+TEST_CASE("groupby_sorted: yields the same groups as groupby",
+    "[groupby_sorted]") {
+  const std::vector<int> ns = {1, 1, 1, 2, 3, 3, 3, 3, 3, 3, 3, 4, 4, 9};
+  std::vector<int> keys;
+  std::vector<std::vector<int>> groups;
+  SECTION("random access") {
+    for (auto&& gb : groupby_sorted(ns)) {
+      keys.push_back(gb.first);
+      groups.emplace_back(std::begin(gb.second), std::end(gb.second));
+    }
+  }
+  SECTION("not random access") {
+    std::list<int> ls(ns.begin(), ns.end());
+    for (auto&& gb : ls | groupby_sorted) {
+      keys.push_back(gb.first);
+      groups.emplace_back(std::begin(gb.second), std::end(gb.second));
+    }
+  }
+
+  const std::vector<int> kc = {1, 2, 3, 4, 9};
+  const std::vector<std::vector<int>> gc = {
+      {1, 1, 1}, {2}, {3, 3, 3, 3, 3, 3, 3}, {4, 4}, {9}};
+  REQUIRE(keys == kc);
+  REQUIRE(groups == gc);
+}
+
+TEST_CASE("groupby_sorted: skipped groups aren't walked", "[groupby_sorted]") {
+  std::vector<int> ns;
+  for (int k = 0; k < 4; ++k) {
+    ns.insert(ns.end(), 1000, k);
+  }
+  int calls = 0;
+  auto key = [&calls](int i) {
+    ++calls;
+    return i;
+  };
+
+  std::vector<int> keys;
+  for (auto&& gb : groupby_sorted(ns, key)) {
+    keys.push_back(gb.first);
+  }
+  const std::vector<int> kc = {0, 1, 2, 3};
+  REQUIRE(keys == kc);
+  REQUIRE(calls < 200);
+}
+
+TEST_CASE("groupby_sorted: partially used groups", "[groupby_sorted]") {
+  const std::vector<std::string> strs = {
+      "a", "b", "cd", "ef", "gh", "ij", "klm", "nop"};
+  std::vector<std::size_t> keys;
+  std::vector<std::string> firsts;
+  for (auto&& gb : groupby_sorted(strs, &std::string::size)) {
+    keys.push_back(gb.first);
+    firsts.push_back(*std::begin(gb.second));
+  }
+  const std::vector<std::size_t> kc = {1, 2, 3};
+  const std::vector<std::string> fc = {"a", "cd", "klm"};
+  REQUIRE(keys == kc);
+  REQUIRE(firsts == fc);
+}
+
+TEST_CASE("groupby_sorted: group sizes", "[groupby_sorted]") {
+  const std::vector<int> ns = {1, 1, 1, 2, 3, 3, 3, 3, 3, 3, 3, 4, 4, 9};
+  std::vector<std::size_t> sizes;
+  for (auto&& gb : groupby_sorted(ns)) {
+    sizes.push_back(gb.second.size());
+  }
+  const std::vector<std::size_t> sc = {3, 1, 7, 2, 1};
+  REQUIRE(sizes == sc);
+
+  auto g = groupby_sorted(ns);
+  auto it = std::begin(g);
+  auto&& group = it->second;
+  auto group_it = std::begin(group);
+  ++group_it;
+  REQUIRE(group.size() == 2);
+}
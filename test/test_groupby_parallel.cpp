@@ -0,0 +1,118 @@
+#include <groupby.hpp>
+#include <groupby_parallel.hpp>
+
+#include "helpers.hpp"
+
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "catch.hpp"
+
+using iter::groupby_parallel;
+
+namespace {
+  template <typename GroupPairs>
+  std::vector<std::pair<int, std::vector<int>>> collect(GroupPairs&& gps) {
+    std::vector<std::pair<int, std::vector<int>>> result;
+    for (auto&& gp : gps) {
+      result.emplace_back(static_cast<int>(gp.first),
+          std::vector<int>(std::begin(gp.second), std::end(gp.second)));
+    }
+    return result;
+  }
+}
+
+TEST_CASE("groupby_parallel: yields the same groups as groupby",
+    "[groupby_parallel]") {
+  const std::vector<int> ns = {1, 1, 1, 2, 3, 3, 3, 3, 4, 4, 9};
+  auto expected = collect(iter::groupby(ns));
+
+  SECTION("Normal call") {
+    REQUIRE(collect(groupby_parallel(ns)) == expected);
+  }
+  SECTION("Pipe") {
+    REQUIRE(collect(ns | groupby_parallel) == expected);
+  }
+  SECTION("With key function and threads") {
+    REQUIRE(collect(groupby_parallel(ns, [](int i) { return i; }, 4))
+            == expected);
+  }
+  SECTION("Pipe with key function") {
+    REQUIRE(collect(ns | groupby_parallel([](int i) { return i; }, 4))
+            == expected);
+  }
+  SECTION("rvalue input") {
+    REQUIRE(collect(groupby_parallel(std::vector<int>(ns))) == expected);
+  }
+}
+
+TEST_CASE("groupby_parallel: groups spanning the split points",
+    "[groupby_parallel]") {
+  // long enough to be split between threads, with a group covering the
+  // whole middle so that a split point moves past others
+  std::vector<int> ns;
+  for (int k = 0; k < 3000; ++k) {
+    ns.insert(ns.end(), k % 7 + 1, k);
+  }
+  ns.insert(ns.end(), 100000, 3000);
+  for (int k = 3001; k < 9000; ++k) {
+    ns.insert(ns.end(), k % 5 + 1, k);
+  }
+  auto key = [](int i) { return i / 2; };
+  auto expected = collect(iter::groupby(ns, key));
+  for (std::size_t threads : {1, 2, 3, 8, 64}) {
+    REQUIRE(collect(groupby_parallel(ns, key, threads)) == expected);
+  }
+}
+
+TEST_CASE("groupby_parallel: calls the key function once per element",
+    "[groupby_parallel]") {
+  const std::vector<int> ns = {1, 1, 2, 3, 3, 3, 4};
+  int calls = 0;
+  auto g = groupby_parallel(ns,
+      [&calls](int i) {
+        ++calls;
+        return i;
+      },
+      1);
+  REQUIRE(calls == static_cast<int>(ns.size()));
+  REQUIRE(g.size() == 4);
+}
+
+TEST_CASE("groupby_parallel: groups are random access ranges of the input",
+    "[groupby_parallel]") {
+  const std::vector<std::string> strs = {"a", "b", "cd", "ef", "gh", "ijk"};
+  auto g = groupby_parallel(strs, &std::string::size);
+  auto it = std::begin(g);
+  auto first_group = it->second;
+  ++it;
+  REQUIRE(it->first == 2);
+  REQUIRE(it->second.size() == 3);
+  REQUIRE(&it->second[1] == &strs[3]);
+  // a group stays usable after moving past it
+  REQUIRE(first_group.size() == 2);
+  REQUIRE(first_group[0] == "a");
+}
+
+TEST_CASE("groupby_parallel: const iteration", "[groupby_parallel][const]") {
+  const auto g = groupby_parallel(std::vector<int>{1, 1, 2});
+  const std::vector<std::pair<int, std::vector<int>>> expected = {
+      {1, {1, 1}}, {2, {2}}};
+  REQUIRE(collect(g) == expected);
+}
+
+TEST_CASE("groupby_parallel: empty input yields nothing",
+    "[groupby_parallel]") {
+  std::vector<int> ns{};
+  auto g = groupby_parallel(ns);
+  REQUIRE(std::begin(g) == std::end(g));
+}
+
+TEST_CASE("groupby_parallel: iterator meets requirements",
+    "[groupby_parallel]") {
+  std::vector<int> ns = {1, 2};
+  auto g = groupby_parallel(ns);
+  REQUIRE(itertest::IsIterator<decltype(std::begin(g))>::value);
+}
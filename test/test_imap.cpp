@@ -93,8 +93,6 @@ TEST_CASE("imap: works with pointer to member function taking argument") {
   REQUIRE(v == vc);
 }
 
-// TODO enable once zip supports const
-#if 0
 TEST_CASE("imap: supports const iteration", "[imap][const]") {
   Vec ns = {10, 20, 30};
   const auto m = imap(PlusOner{}, ns);
@@ -108,7 +106,6 @@ TEST_CASE("imap: const iterators can be compared to non-const iterators", "[imap
   const auto& cm = m;
   (void)(std::begin(m) == std::end(cm));
 }
-#endif
 
 TEST_CASE("imap: Works with different begin and end types", "[imap]") {
   CharRange cr{'d'};
@@ -145,6 +142,24 @@ TEST_CASE("imap: terminates on shortest squence", "[imap]") {
   }
 }
 
+TEST_CASE("imap: size()", "[imap]") {
+  Vec ns1 = {1, 2, 3, 4};
+  Vec ns2 = {2, 4, 6};
+  REQUIRE(imap(plusone, ns1).size() == 4);
+  REQUIRE(imap([](int a, int b) { return a + b; }, ns1, ns2).size() == 3);
+  REQUIRE(imap(plusone, Vec{}).size() == 0);
+}
+
+TEST_CASE("imap: passes elements directly to the function", "[imap]") {
+  std::vector<int> ns = {1, 2, 3};
+  std::vector<int> ms = {10, 20, 30};
+  for (auto&& r : imap([](int& a, int& b) -> int& { return a += b; }, ns, ms)) {
+    r *= 2;
+  }
+  Vec vc = {22, 44, 66};
+  REQUIRE(ns == vc);
+}
+
 TEST_CASE("imap: operator->", "[imap]") {
   std::vector<std::string> vs = {"ab", "abcd", "abcdefg"};
   {
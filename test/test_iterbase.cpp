@@ -29,6 +29,24 @@ TEST_CASE("Detects random access iterators correctly", "[iterbase]") {
   REQUIRE_FALSE(hrai<itertest::BasicIterable<int>>::value);
 }
 
+TEST_CASE("Detects sized, contiguous, and random access iterables",
+    "[iterbase]") {
+  REQUIRE(it::has_size<std::vector<int>>);
+  REQUIRE(it::has_size<int[10]>);
+  REQUIRE(it::has_size<std::list<int>>);
+  REQUIRE_FALSE(it::has_size<itertest::BasicIterable<int>>);
+
+  REQUIRE(it::is_contiguous<std::vector<int>>);
+  REQUIRE(it::is_contiguous<const std::string>);
+  REQUIRE(it::is_contiguous<int[10]>);
+  REQUIRE_FALSE(it::is_contiguous<std::vector<bool>>);
+  REQUIRE_FALSE(it::is_contiguous<std::list<int>>);
+
+  REQUIRE(it::is_random_access_iterable<std::vector<int>>);
+  REQUIRE_FALSE(it::is_random_access_iterable<std::list<int>>);
+  REQUIRE_FALSE(it::is_random_access_iterable<int>);
+}
+
 TEST_CASE("Detects correct iterator types", "[iterbase]") {
   REQUIRE((std::is_same<it::iterator_type<IVec>, IVec::iterator>::value));
   REQUIRE((std::is_same<it::iterator_type<IVec>, IVec::iterator>::value));
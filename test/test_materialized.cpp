@@ -0,0 +1,169 @@
+#include <materialized.hpp>
+
+#include <batched.hpp>
+#include <chunked.hpp>
+#include <combinations.hpp>
+#include <filter.hpp>
+#include <imap.hpp>
+#include <permutations.hpp>
+#include <range.hpp>
+#include <shuffled.hpp>
+#include <sliding_window.hpp>
+#include <sorted.hpp>
+
+#include "helpers.hpp"
+
+#include <algorithm>
+#include <list>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "catch.hpp"
+
+using iter::materialized;
+using itertest::BasicIterable;
+
+using Vec = const std::vector<int>;
+
+namespace {
+  // counts how many times it has been called
+  struct CountingNegate {
+    int* calls;
+    int operator()(int i) const {
+      ++*calls;
+      return -i;
+    }
+  };
+}
+
+TEST_CASE("materialized: yields the same elements", "[materialized]") {
+  Vec ns{3, 1, 2};
+  std::vector<int> v;
+  SECTION("Normal call") {
+    auto m = materialized(ns);
+    v.assign(std::begin(m), std::end(m));
+  }
+  SECTION("Pipe") {
+    auto m = ns | materialized;
+    v.assign(std::begin(m), std::end(m));
+  }
+  REQUIRE(v == ns);
+}
+
+TEST_CASE("materialized: works with non-sized iterables", "[materialized]") {
+  BasicIterable<int> bi{1, 2, 3};
+  auto m = materialized(bi);
+  Vec v(std::begin(m), std::end(m));
+  REQUIRE(v == Vec{1, 2, 3});
+  REQUIRE(m.size() == 3);
+
+  auto m2 = materialized(iter::range(4));
+  Vec v2(std::begin(m2), std::end(m2));
+  REQUIRE(v2 == Vec{0, 1, 2, 3});
+}
+
+TEST_CASE("materialized: evaluates each element once", "[materialized]") {
+  Vec ns{4, 2, 5, 1, 3};
+  int calls = 0;
+  auto values = [&] {
+    return materialized(iter::imap(CountingNegate{&calls}, ns));
+  };
+
+  SECTION("sorted") {
+    auto s = iter::sorted(values());
+    Vec v(std::begin(s), std::end(s));
+    REQUIRE(v == Vec{-5, -4, -3, -2, -1});
+  }
+  SECTION("sliding_window") {
+    for (auto&& w : iter::sliding_window(values(), 3)) {
+      REQUIRE(w.get().size() == 3);
+    }
+  }
+  SECTION("chunked") {
+    for (auto&& c : iter::chunked(values(), 2)) {
+      (void)c;
+    }
+  }
+  SECTION("batched") {
+    for (auto&& b : iter::batched(values(), 2)) {
+      (void)b;
+    }
+  }
+  SECTION("permutations") {
+    int n = 0;
+    for (auto&& p : iter::permutations(values())) {
+      (void)p;
+      ++n;
+    }
+    REQUIRE(n == 120);
+  }
+  SECTION("combinations") {
+    int n = 0;
+    for (auto&& c : iter::combinations(values(), 2)) {
+      for (auto&& i : c) {
+        (void)i;
+      }
+      ++n;
+    }
+    REQUIRE(n == 10);
+  }
+  SECTION("shuffled") {
+    auto s = iter::shuffled(values());
+    std::vector<int> v(std::begin(s), std::end(s));
+    std::sort(v.begin(), v.end());
+    REQUIRE(v == Vec{-5, -4, -3, -2, -1});
+  }
+  REQUIRE(calls == 5);
+}
+
+TEST_CASE("materialized: moves prvalues", "[materialized]") {
+  std::vector<std::string> ss{"abc", "de"};
+  auto m = materialized(
+      iter::imap([](const std::string& s) { return s + s; }, ss));
+  std::vector<std::string> v(std::begin(m), std::end(m));
+  REQUIRE(v == std::vector<std::string>{"abcabc", "dede"});
+}
+
+TEST_CASE("materialized: works with move-only prvalues", "[materialized]") {
+  const std::vector<int> ns{1, 2};
+  auto m = materialized(
+      iter::imap([](int i) { return std::make_unique<int>(i); }, ns));
+  std::vector<int> v;
+  for (auto&& p : m) {
+    v.push_back(*p);
+  }
+  REQUIRE(v == std::vector<int>{1, 2});
+}
+
+TEST_CASE("materialized: copies elements of rvalue views",
+    "[materialized]") {
+  std::vector<std::string> ss{"abc", "de", "fgh"};
+  SECTION("filter") {
+    auto m = materialized(
+        iter::filter([](const std::string& s) { return s.size() == 3; }, ss));
+    std::vector<std::string> v(std::begin(m), std::end(m));
+    REQUIRE(v == std::vector<std::string>{"abc", "fgh"});
+  }
+  SECTION("sorted") {
+    auto m = materialized(iter::sorted(ss));
+    std::vector<std::string> v(std::begin(m), std::end(m));
+    REQUIRE(v == std::vector<std::string>{"abc", "de", "fgh"});
+  }
+  REQUIRE(ss == std::vector<std::string>{"abc", "de", "fgh"});
+}
+
+TEST_CASE("materialized: copies elements of lvalue containers",
+    "[materialized]") {
+  std::vector<std::string> ss{"abc", "de"};
+  auto m = materialized(ss);
+  std::vector<std::string> v(std::begin(m), std::end(m));
+  REQUIRE(v == ss);
+  REQUIRE(ss == std::vector<std::string>{"abc", "de"});
+}
+
+TEST_CASE("materialized: const iteration", "[materialized][const]") {
+  const auto m = materialized(std::list<int>{1, 2});
+  Vec v(std::begin(m), std::end(m));
+  REQUIRE(v == Vec{1, 2});
+}
@@ -0,0 +1,135 @@
+#include <memo_imap.hpp>
+
+#include "helpers.hpp"
+
+#include <string>
+#include <vector>
+
+#include "catch.hpp"
+
+using iter::memo_imap;
+using itertest::BasicIterable;
+
+using Vec = const std::vector<int>;
+
+namespace {
+  struct CountingSquare {
+    int* calls;
+    int operator()(int i) const {
+      ++*calls;
+      return i * i;
+    }
+  };
+}
+
+TEST_CASE("memo_imap: computes each distinct value once", "[memo_imap]") {
+  Vec ns{1, 2, 1, 3, 2, 1, 1};
+  Vec vc{1, 4, 1, 9, 4, 1, 1};
+  int calls = 0;
+  std::vector<int> v;
+  SECTION("Normal call") {
+    auto m = memo_imap(CountingSquare{&calls}, ns);
+    v.assign(std::begin(m), std::end(m));
+  }
+  SECTION("Pipe") {
+    auto m = ns | memo_imap(CountingSquare{&calls});
+    v.assign(std::begin(m), std::end(m));
+  }
+  SECTION("LRU") {
+    auto m = memo_imap(CountingSquare{&calls}, ns, iter::lru_cache(8));
+    v.assign(std::begin(m), std::end(m));
+  }
+  SECTION("CLOCK") {
+    auto m = memo_imap(CountingSquare{&calls}, ns, iter::clock_cache(8));
+    v.assign(std::begin(m), std::end(m));
+  }
+  SECTION("Pipe with LRU") {
+    auto m = ns | memo_imap(CountingSquare{&calls}, iter::lru_cache(8));
+    v.assign(std::begin(m), std::end(m));
+  }
+  SECTION("Pipe with CLOCK") {
+    auto m = ns | memo_imap(CountingSquare{&calls}, iter::clock_cache(8));
+    v.assign(std::begin(m), std::end(m));
+  }
+  REQUIRE(v == vc);
+  REQUIRE(calls == 3);
+}
+
+TEST_CASE("memo_imap: cache is kept across iterations", "[memo_imap]") {
+  Vec ns{1, 2, 3};
+  int calls = 0;
+  auto m = memo_imap(CountingSquare{&calls}, ns);
+  Vec v1(std::begin(m), std::end(m));
+  Vec v2(std::begin(m), std::end(m));
+  REQUIRE(v1 == v2);
+  REQUIRE(calls == 3);
+}
+
+TEST_CASE("memo_imap: multiple containers", "[memo_imap]") {
+  Vec ns{1, 2, 1, 2};
+  const std::vector<std::string> ss{"a", "b", "a", "c"};
+  int calls = 0;
+  auto f = [&calls](int i, const std::string& s) {
+    ++calls;
+    return std::string(static_cast<std::size_t>(i), s[0]);
+  };
+  auto m = memo_imap(f, ns, ss, iter::clock_cache(4));
+  std::vector<std::string> v(std::begin(m), std::end(m));
+  REQUIRE(v == std::vector<std::string>{"a", "bb", "a", "cc"});
+  REQUIRE(calls == 3);
+}
+
+TEST_CASE("memo_imap: LRU evicts the least recently used", "[memo_imap]") {
+  // 1 is used again just before 3 is inserted, so 2 is evicted
+  Vec ns{1, 2, 1, 3, 1, 2};
+  int calls = 0;
+  auto m = memo_imap(CountingSquare{&calls}, ns, iter::lru_cache(2));
+  Vec v(std::begin(m), std::end(m));
+  REQUIRE(v == Vec{1, 4, 1, 9, 1, 4});
+  REQUIRE(calls == 4);
+}
+
+TEST_CASE("memo_imap: CLOCK gives referenced entries a second chance",
+    "[memo_imap]") {
+  // 1 is referenced, so inserting 3 evicts 2
+  Vec ns{1, 2, 1, 3, 1, 2};
+  int calls = 0;
+  auto m = memo_imap(CountingSquare{&calls}, ns, iter::clock_cache(2));
+  Vec v(std::begin(m), std::end(m));
+  REQUIRE(v == Vec{1, 4, 1, 9, 1, 4});
+  REQUIRE(calls == 4);
+}
+
+TEST_CASE("memo_imap: zero capacity caches nothing", "[memo_imap]") {
+  Vec ns{1, 1, 1};
+  int calls = 0;
+  auto m = memo_imap(CountingSquare{&calls}, ns, iter::lru_cache(0));
+  Vec v(std::begin(m), std::end(m));
+  REQUIRE(v == Vec{1, 1, 1});
+  REQUIRE(calls == 3);
+}
+
+TEST_CASE("memo_imap: works with non-sized iterables", "[memo_imap]") {
+  BasicIterable<int> bi{2, 2};
+  int calls = 0;
+  auto m = memo_imap(CountingSquare{&calls}, bi);
+  Vec v(std::begin(m), std::end(m));
+  REQUIRE(v == Vec{4, 4});
+  REQUIRE(calls == 1);
+}
+
+TEST_CASE("memo_imap: const iteration and size", "[memo_imap][const]") {
+  Vec ns{3, 3};
+  int calls = 0;
+  const auto m = memo_imap(CountingSquare{&calls}, ns);
+  Vec v(std::begin(m), std::end(m));
+  REQUIRE(v == Vec{9, 9});
+  REQUIRE(calls == 1);
+  REQUIRE(m.size() == 2);
+}
+
+TEST_CASE("memo_imap: iterator meets requirements", "[memo_imap]") {
+  Vec ns{};
+  auto m = memo_imap([](int i) { return i; }, ns);
+  REQUIRE(itertest::IsIterator<decltype(std::begin(m))>::value);
+}
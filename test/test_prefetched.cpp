@@ -0,0 +1,147 @@
+#include <prefetched.hpp>
+#include <sorted.hpp>
+
+#include "helpers.hpp"
+
+#include <iterator>
+#include <list>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "catch.hpp"
+
+using iter::prefetched;
+using itertest::BasicIterable;
+using itertest::SolidInt;
+
+using Vec = const std::vector<int>;
+
+TEST_CASE("prefetched: yields the same elements", "[prefetched]") {
+  Vec ns{4, 1, 3, 2, 5};
+  std::vector<int> v;
+  SECTION("Normal call") {
+    auto p = prefetched(ns);
+    v.assign(std::begin(p), std::end(p));
+  }
+  SECTION("With distance") {
+    auto p = prefetched(ns, 2);
+    v.assign(std::begin(p), std::end(p));
+  }
+  SECTION("Pipe") {
+    auto p = ns | prefetched;
+    v.assign(std::begin(p), std::end(p));
+  }
+  SECTION("Pipe with distance") {
+    auto p = ns | prefetched(100);
+    v.assign(std::begin(p), std::end(p));
+  }
+  REQUIRE(v == ns);
+}
+
+TEST_CASE("prefetched: empty", "[prefetched]") {
+  Vec ns{};
+  auto p = prefetched(ns);
+  REQUIRE(std::begin(p) == std::end(p));
+}
+
+TEST_CASE("prefetched: yields references", "[prefetched]") {
+  std::vector<int> ns{1, 2, 3};
+  for (auto&& i : prefetched(ns, 1)) {
+    i *= 10;
+  }
+  REQUIRE(ns == Vec{10, 20, 30});
+}
+
+TEST_CASE("prefetched: works with sorted", "[prefetched]") {
+  Vec ns{4, 1, 3, 2, 5};
+  auto p = prefetched(iter::sorted(ns), 3);
+  Vec v(std::begin(p), std::end(p));
+  REQUIRE(v == Vec{1, 2, 3, 4, 5});
+}
+
+TEST_CASE("prefetched: with a projection", "[prefetched]") {
+  std::vector<std::unique_ptr<int>> ps;
+  for (int i = 0; i < 20; ++i) {
+    ps.push_back(std::make_unique<int>(i));
+  }
+  int projected = 0;
+  auto proj = [&projected](const std::unique_ptr<int>& p) {
+    ++projected;
+    return p.get();
+  };
+  auto p = prefetched(ps, 4, proj);
+  int expected = 0;
+  for (auto&& up : p) {
+    REQUIRE(*up == expected);
+    ++expected;
+  }
+  REQUIRE(expected == 20);
+  REQUIRE(projected == 20);
+}
+
+TEST_CASE("prefetched: works with non-sized iterables", "[prefetched]") {
+  std::list<int> li{1, 2, 3};
+  auto p = prefetched(li, 2);
+  Vec v(std::begin(p), std::end(p));
+  REQUIRE(v == Vec{1, 2, 3});
+
+  BasicIterable<int> bi{1, 2};
+  auto p2 = prefetched(bi);
+  Vec v2(std::begin(p2), std::end(p2));
+  REQUIRE(v2 == Vec{1, 2});
+}
+
+namespace {
+  struct IntStream {
+    std::istringstream in;
+    std::istream_iterator<int> begin() {
+      return std::istream_iterator<int>{in};
+    }
+    std::istream_iterator<int> end() {
+      return {};
+    }
+  };
+}
+
+TEST_CASE("prefetched: works with single-pass iterables", "[prefetched]") {
+  IntStream s{std::istringstream{"1 2 3 4 5 6 7 8 9 10"}};
+  auto p = prefetched(s, 2);
+  Vec v(std::begin(p), std::end(p));
+  REQUIRE(v == Vec{1, 2, 3, 4, 5, 6, 7, 8, 9, 10});
+}
+
+TEST_CASE("prefetched: size", "[prefetched]") {
+  Vec ns{1, 2, 3};
+  REQUIRE(prefetched(ns).size() == 3);
+}
+
+TEST_CASE("prefetched: const iteration", "[prefetched][const]") {
+  std::vector<std::string> ss{"a", "bb"};
+  const auto p = prefetched(ss);
+  auto it = std::begin(p);
+  REQUIRE(it->size() == 1);
+  ++it;
+  REQUIRE(*it == "bb");
+  ++it;
+  REQUIRE(it == std::end(p));
+}
+
+TEST_CASE("prefetched: binds to lvalues, moves rvalues", "[prefetched]") {
+  BasicIterable<int> bi{1, 2};
+  SECTION("binds to lvalues") {
+    prefetched(bi);
+    REQUIRE_FALSE(bi.was_moved_from());
+  }
+  SECTION("moves rvalues") {
+    prefetched(std::move(bi));
+    REQUIRE(bi.was_moved_from());
+  }
+}
+
+TEST_CASE("prefetched: iterator meets requirements", "[prefetched]") {
+  std::string s{};
+  auto p = prefetched(s);
+  REQUIRE(itertest::IsIterator<decltype(std::begin(p))>::value);
+}
@@ -0,0 +1,186 @@
+#include <reduce.hpp>
+#include <accumulate.hpp>
+#include <imap.hpp>
+#include "helpers.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "catch.hpp"
+
+using iter::reduce;
+using itertest::BasicIterable;
+
+using Vec = const std::vector<int>;
+
+TEST_CASE("reduce: Simple sum", "[reduce]") {
+  Vec ns{1, 2, 3, 4, 5};
+  SECTION("Normal call") {
+    REQUIRE(reduce(ns) == 15);
+  }
+  SECTION("Pipe") {
+    REQUIRE((ns | reduce) == 15);
+  }
+}
+
+TEST_CASE("reduce: With subtraction lambda", "[reduce]") {
+  Vec ns{5, 4, 3, 2, 1};
+  auto sub = [](int a, int b) { return a - b; };
+  SECTION("Normal call") {
+    REQUIRE(reduce(ns, sub) == -5);
+  }
+  SECTION("Pipe") {
+    REQUIRE((ns | reduce(sub)) == -5);
+  }
+}
+
+TEST_CASE("reduce: handles pointer to member function", "[reduce]") {
+  using itertest::Point;
+  std::vector<Point> ps = {{1, 2}, {10, 50}, {300, 600}};
+  REQUIRE(reduce(ps, &Point::add) == Point{311, 652});
+}
+
+TEST_CASE("reduce: empty gives nullopt", "[reduce]") {
+  REQUIRE_FALSE(reduce(Vec{}).has_value());
+  REQUIRE_FALSE(reduce(std::list<int>{}).has_value());
+}
+
+TEST_CASE("reduce: gives the last value of accumulate", "[reduce]") {
+  std::vector<int> ns;
+  for (int i = 1; i < 100; ++i) {
+    ns.push_back(i % 7 - 3);
+  }
+  for (std::size_t len = 0; len < ns.size(); ++len) {
+    std::vector<int> sub(ns.begin(), ns.begin() + len);
+    std::optional<int> expected;
+    for (auto&& i : iter::accumulate(sub)) {
+      expected = i;
+    }
+    REQUIRE(reduce(sub) == expected);
+    std::list<int> li(sub.begin(), sub.end());
+    REQUIRE(reduce(li) == expected);
+  }
+}
+
+TEST_CASE("reduce: contiguous arithmetic with standard ops", "[reduce]") {
+  std::vector<double> ds;
+  for (int i = 0; i < 1003; ++i) {
+    ds.push_back(i * 0.5);
+  }
+  // every partial sum is exactly representable
+  REQUIRE(reduce(ds) == 1003.0 * 1002.0 / 4);
+
+  std::vector<long> ls{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+  REQUIRE(reduce(ls, std::multiplies<>{}) == 39916800L);
+  REQUIRE(reduce(ls, std::bit_or<long>{}) == 15);
+  REQUIRE(reduce(ls, std::bit_xor<long>{}) == 0);
+
+  unsigned char cs[] = {200, 200, 200, 200, 200, 200, 200, 200, 200};
+  REQUIRE(reduce(cs) == 1800);
+}
+
+TEST_CASE("reduce: minimum and maximum", "[reduce]") {
+  std::vector<int> ns;
+  for (int i = 0; i < 1000; ++i) {
+    ns.push_back((i * 37) % 1001 - 500);
+  }
+  REQUIRE(reduce(ns, iter::minimum) == *std::min_element(ns.begin(), ns.end()));
+  REQUIRE(reduce(ns, iter::maximum) == *std::max_element(ns.begin(), ns.end()));
+
+  std::list<double> ds{3.5, -1.0, 2.0};
+  REQUIRE(reduce(ds, iter::minimum) == -1.0);
+  REQUIRE((ds | reduce(iter::maximum)) == 3.5);
+
+  std::vector<std::string> ss{"pear", "apple", "fig"};
+  REQUIRE(reduce(ss, iter::minimum) == std::string{"apple"});
+}
+
+namespace {
+  // records the arguments of its first call, to tell how reduce grouped
+  // the values
+  struct FirstCall {
+    std::pair<int, int>* first;
+    int operator()(int a, int b) const {
+      if (first->first < 0) {
+        *first = {a, b};
+      }
+      return a + b;
+    }
+  };
+
+  struct TaggedFirstCall : FirstCall {
+    using is_associative = void;
+  };
+
+  struct SpecializedFirstCall : FirstCall {};
+}
+
+template <>
+struct iter::is_associative_op<SpecializedFirstCall> : std::true_type {};
+
+TEST_CASE("reduce: regroups user functions marked associative", "[reduce]") {
+  std::vector<int> ns;
+  for (int i = 0; i < 100; ++i) {
+    ns.push_back(i);
+  }
+  std::pair<int, int> first{-1, -1};
+  SECTION("unmarked functions are applied left to right") {
+    REQUIRE(reduce(ns, FirstCall{&first}) == 4950);
+    REQUIRE(first == std::pair<int, int>{0, 1});
+  }
+  SECTION("marked with a member type") {
+    REQUIRE(reduce(ns, TaggedFirstCall{{&first}}) == 4950);
+    REQUIRE(first == std::pair<int, int>{0, 8});
+  }
+  SECTION("marked by specializing is_associative_op") {
+    REQUIRE(reduce(ns, SpecializedFirstCall{{&first}}) == 4950);
+    REQUIRE(first == std::pair<int, int>{0, 8});
+  }
+}
+
+TEST_CASE("reduce: sum of an imap of products", "[reduce]") {
+  std::vector<double> a;
+  std::vector<float> b;
+  double expected = 0;
+  for (int i = 0; i < 1001; ++i) {
+    a.push_back(i * 0.25);
+    b.push_back(static_cast<float>(i % 9));
+    expected += a.back() * static_cast<double>(b.back());
+  }
+  // every product and partial sum is exactly representable
+  REQUIRE(reduce(iter::imap(std::multiplies<>{}, a, b)) == expected);
+
+  std::vector<int> is{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+  std::vector<int> js{10, 9, 8, 7, 6, 5, 4, 3, 2};
+  REQUIRE(reduce(iter::imap(std::multiplies<int>{}, is, js))
+          == 10 + 18 + 24 + 28 + 30 + 30 + 28 + 24 + 18);
+}
+
+TEST_CASE("reduce: products in a different type than the sum", "[reduce]") {
+  const std::vector<double> a(16, 1.5);
+  const std::vector<double> b(16, 2.5);
+  // each product is int(1.5) * int(2.5), as it is when folded one by one
+  REQUIRE(reduce(iter::imap(std::multiplies<int>{}, a, b), std::plus<double>{})
+          == 32.0);
+  REQUIRE(reduce(iter::imap(std::multiplies<int>{}, std::vector<double>(4, 1.5),
+                     std::vector<double>(4, 2.5)),
+              std::plus<double>{})
+          == 8.0);
+}
+
+TEST_CASE("reduce: preserves order for non-commutative operations",
+    "[reduce]") {
+  std::vector<std::string> vs{"a", "b", "c", "d", "e", "f", "g", "h", "i"};
+  REQUIRE(reduce(vs) == std::string{"abcdefghi"});
+}
+
+TEST_CASE("reduce: works with minimal iterables", "[reduce]") {
+  BasicIterable<int> bi{1, 2, 3};
+  REQUIRE(reduce(bi) == 6);
+  REQUIRE(reduce(std::move(bi)) == 6);
+}
@@ -0,0 +1,101 @@
+#include <filter.hpp>
+#include <range.hpp>
+#include <sample.hpp>
+
+#include "helpers.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <list>
+#include <string>
+#include <vector>
+
+#include "catch.hpp"
+
+using iter::sample;
+
+TEST_CASE("sample: picks k distinct elements of the input", "[sample]") {
+  std::vector<int> ns(1000);
+  for (int i = 0; i < 1000; ++i) {
+    ns[static_cast<std::size_t>(i)] = i;
+  }
+  std::vector<int> s;
+  SECTION("Normal call") {
+    s = sample(ns, 10, 42);
+  }
+  SECTION("Pipe") {
+    s = ns | sample(10, 42);
+  }
+  SECTION("Not random access") {
+    std::list<int> ls(ns.begin(), ns.end());
+    s = sample(ls, 10, 42);
+  }
+  REQUIRE(s.size() == 10);
+  std::sort(s.begin(), s.end());
+  REQUIRE(std::adjacent_find(s.begin(), s.end()) == s.end());
+  REQUIRE(s.front() >= 0);
+  REQUIRE(s.back() < 1000);
+}
+
+TEST_CASE("sample: is repeatable for the same seed", "[sample]") {
+  auto r = iter::range(100000);
+  REQUIRE(sample(r, 20, 7) == sample(r, 20, 7));
+  REQUIRE(sample(r, 20, 7) != sample(r, 20, 8));
+}
+
+TEST_CASE("sample: short input gives all of it", "[sample]") {
+  const std::vector<std::string> strs = {"a", "b", "c"};
+  REQUIRE(sample(strs, 3) == strs);
+  REQUIRE(sample(strs, 10) == strs);
+}
+
+TEST_CASE("sample: k of 0 gives nothing", "[sample]") {
+  const std::vector<int> ns = {1, 2, 3};
+  REQUIRE(sample(ns, 0).empty());
+}
+
+TEST_CASE("sample: works with filtered input", "[sample]") {
+  auto evens =
+      iter::filter([](int i) { return i % 2 == 0; }, iter::range(10000));
+  auto s = sample(evens, 50, 3);
+  REQUIRE(s.size() == 50);
+  REQUIRE(std::all_of(
+      s.begin(), s.end(), [](int i) { return i % 2 == 0 && i < 10000; }));
+}
+
+TEST_CASE("sample: works with input iterators", "[sample]") {
+  itertest::InputIterable seq;
+  auto s = sample(seq, 2);
+  REQUIRE(s.size() == 2);
+}
+
+TEST_CASE("sample: every element is about as likely", "[sample]") {
+  constexpr int n = 20;
+  constexpr int k = 5;
+  constexpr int trials = 20000;
+  std::vector<int> counts(n);
+  for (int t = 0; t < trials; ++t) {
+    for (int i : sample(iter::range(n), k, static_cast<std::uint64_t>(t))) {
+      ++counts[static_cast<std::size_t>(i)];
+    }
+  }
+  // each element is expected trials * k / n = 5000 times
+  REQUIRE(*std::min_element(counts.begin(), counts.end()) > 4500);
+  REQUIRE(*std::max_element(counts.begin(), counts.end()) < 5500);
+}
+
+TEST_CASE("sample: reaches the end of long input", "[sample]") {
+  std::vector<int> ns(1000000);
+  for (std::size_t i = 0; i < ns.size(); ++i) {
+    ns[i] = static_cast<int>(i);
+  }
+  auto s = sample(ns, 1000, 11);
+  REQUIRE(s.size() == 1000);
+  double mean = 0;
+  for (int i : s) {
+    mean += i / 1000.0;
+  }
+  REQUIRE(mean > 450000);
+  REQUIRE(mean < 550000);
+  REQUIRE(*std::max_element(s.begin(), s.end()) > 990000);
+}
@@ -0,0 +1,118 @@
+#include <gather.hpp>
+#include <sample_indices.hpp>
+
+#include "helpers.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "catch.hpp"
+
+using iter::sample_indices;
+
+namespace {
+  std::vector<std::size_t> collect(
+      std::size_t n, std::size_t k, std::uint64_t seed) {
+    auto s = sample_indices(n, k, seed);
+    return std::vector<std::size_t>(std::begin(s), std::end(s));
+  }
+}
+
+TEST_CASE("sample_indices: yields k distinct sorted indices",
+    "[sample_indices]") {
+  // covers both small n, where method A is used throughout, and large n
+  for (std::size_t n : {10ul, 100ul, 1000ul, 100000ul, 10000000ul}) {
+    for (std::size_t k : {1ul, 2ul, 5ul, 10ul, 50ul}) {
+      if (k > n) {
+        continue;
+      }
+      auto is = collect(n, k, n + k);
+      REQUIRE(is.size() == k);
+      REQUIRE(std::is_sorted(is.begin(), is.end()));
+      REQUIRE(std::adjacent_find(is.begin(), is.end()) == is.end());
+      REQUIRE(is.back() < n);
+    }
+  }
+}
+
+TEST_CASE("sample_indices: k of at least n gives every index",
+    "[sample_indices]") {
+  const std::vector<std::size_t> all = {0, 1, 2, 3, 4};
+  REQUIRE(collect(5, 5, 1) == all);
+  REQUIRE(collect(5, 9, 1) == all);
+  REQUIRE(sample_indices(5, 9).size() == 5);
+}
+
+TEST_CASE("sample_indices: k of 0 or n of 0 gives nothing",
+    "[sample_indices]") {
+  auto s = sample_indices(10, 0);
+  REQUIRE(std::begin(s) == std::end(s));
+  auto s2 = sample_indices(0, 10);
+  REQUIRE(std::begin(s2) == std::end(s2));
+}
+
+TEST_CASE("sample_indices: is repeatable for the same seed",
+    "[sample_indices]") {
+  REQUIRE(collect(1000000, 100, 3) == collect(1000000, 100, 3));
+  REQUIRE(collect(1000000, 100, 3) != collect(1000000, 100, 4));
+
+  // iterating twice gives the same indices
+  auto s = sample_indices(1000000, 100, 3);
+  REQUIRE(std::vector<std::size_t>(std::begin(s), std::end(s))
+          == std::vector<std::size_t>(std::begin(s), std::end(s)));
+}
+
+TEST_CASE("sample_indices: huge ranges", "[sample_indices]") {
+  const std::size_t n = std::size_t{1} << 40;
+  auto is = collect(n, 100000, 9);
+  REQUIRE(is.size() == 100000);
+  REQUIRE(std::adjacent_find(is.begin(), is.end(),
+              [](std::size_t a, std::size_t b) { return a >= b; })
+          == is.end());
+  REQUIRE(is.back() < n);
+  // the indices should be spread over the whole range
+  REQUIRE(is.front() < n / 1000);
+  REQUIRE(is.back() > n - n / 1000);
+}
+
+TEST_CASE("sample_indices: every index is about as likely",
+    "[sample_indices]") {
+  // large enough n for method D to be used for most picks
+  constexpr std::size_t n = 200;
+  constexpr std::size_t k = 4;
+  constexpr int trials = 50000;
+  std::vector<int> counts(n);
+  for (int t = 0; t < trials; ++t) {
+    for (auto i : sample_indices(n, k, static_cast<std::uint64_t>(t))) {
+      ++counts[i];
+    }
+  }
+  // each index is expected trials * k / n = 1000 times
+  REQUIRE(*std::min_element(counts.begin(), counts.end()) > 850);
+  REQUIRE(*std::max_element(counts.begin(), counts.end()) < 1150);
+}
+
+TEST_CASE("sample_indices: works with gather", "[sample_indices]") {
+  std::vector<std::string> rows;
+  for (int i = 0; i < 1000; ++i) {
+    rows.push_back(std::to_string(i));
+  }
+  std::vector<std::string> picked;
+  for (auto&& row : iter::gather(rows, sample_indices(rows.size(), 10, 5))) {
+    picked.push_back(row);
+  }
+  std::vector<std::string> expected;
+  for (auto i : sample_indices(rows.size(), 10, 5)) {
+    expected.push_back(rows[i]);
+  }
+  REQUIRE(picked == expected);
+}
+
+TEST_CASE("sample_indices: iterator meets requirements",
+    "[sample_indices]") {
+  auto s = sample_indices(10, 3);
+  REQUIRE(itertest::IsIterator<decltype(std::begin(s))>::value);
+}
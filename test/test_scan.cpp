@@ -0,0 +1,129 @@
+#include <scan.hpp>
+#include <accumulate.hpp>
+#include "helpers.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <array>
+#include <list>
+#include <string>
+#include <vector>
+
+#include "catch.hpp"
+
+using iter::scan;
+using itertest::BasicIterable;
+
+using Vec = const std::vector<int>;
+
+TEST_CASE("scan: Simple sum", "[scan]") {
+  Vec ns{1, 2, 3, 4, 5};
+  std::vector<int> v;
+  SECTION("Normal call") {
+    v = scan(ns);
+  }
+  SECTION("Pipe") {
+    v = ns | scan;
+  }
+
+  Vec vc{1, 3, 6, 10, 15};
+  REQUIRE(v == vc);
+}
+
+TEST_CASE("scan: With subtraction lambda", "[scan]") {
+  Vec ns{5, 4, 3, 2, 1};
+  std::vector<int> v;
+  auto sub = [](int a, int b) { return a - b; };
+  SECTION("Normal call") {
+    v = scan(ns, sub);
+  }
+  SECTION("Pipe") {
+    v = ns | scan(sub);
+  }
+
+  Vec vc{5, 1, -2, -4, -5};
+  REQUIRE(v == vc);
+}
+
+TEST_CASE("scan: empty", "[scan]") {
+  REQUIRE(scan(Vec{}).empty());
+  REQUIRE(scan(Vec{}, std::plus<>{}, 4).empty());
+}
+
+TEST_CASE("scan: works with non-random access iterables", "[scan]") {
+  std::list<int> li{1, 2, 3};
+  REQUIRE(scan(li) == Vec{1, 3, 6});
+  BasicIterable<int> bi{1, 2, 3};
+  REQUIRE(scan(bi) == Vec{1, 3, 6});
+}
+
+TEST_CASE("scan: matches accumulate with multiple threads", "[scan]") {
+  std::vector<long> ns;
+  for (long i = 0; i < 200003; ++i) {
+    ns.push_back(i % 13 - 6);
+  }
+  auto a = iter::accumulate(ns);
+  const std::vector<long> expected(std::begin(a), std::end(a));
+
+  for (std::size_t threads : {1, 2, 3, 4, 7, 100}) {
+    REQUIRE(scan(ns, std::plus<>{}, threads) == expected);
+  }
+}
+
+namespace {
+  struct NoDefault {
+    long value;
+    explicit NoDefault(long v) : value{v} {}
+    NoDefault operator+(const NoDefault& other) const {
+      return NoDefault{value + other.value};
+    }
+    bool operator==(const NoDefault& other) const {
+      return value == other.value;
+    }
+  };
+}
+
+TEST_CASE("scan: results that can't be default constructed", "[scan]") {
+  std::vector<NoDefault> ns;
+  for (long i = 0; i < 100000; ++i) {
+    ns.emplace_back(i % 7);
+  }
+  auto s = scan(ns, std::plus<>{}, 4);
+  REQUIRE(s.size() == ns.size());
+  std::vector<NoDefault> expected;
+  long total = 0;
+  for (auto&& n : ns) {
+    total += n.value;
+    expected.emplace_back(total);
+  }
+  REQUIRE(s == expected);
+}
+
+TEST_CASE("scan: bool results", "[scan]") {
+  std::vector<bool> bs(100000, true);
+  bs[70000] = false;
+  auto s = scan(bs, std::logical_and<>{}, 4);
+  REQUIRE(s.size() == bs.size());
+  std::vector<bool> expected(bs.size(), true);
+  std::fill(expected.begin() + 70000, expected.end(), false);
+  REQUIRE(s == expected);
+}
+
+TEST_CASE("scan: keeps order of non-commutative operations", "[scan]") {
+  // each element is a 2x2 matrix, matrix multiplication is associative
+  // but not commutative
+  using Mat = std::array<long, 4>;
+  auto mul = [](const Mat& a, const Mat& b) {
+    return Mat{(a[0] * b[0] + a[1] * b[2]) % 1009,
+        (a[0] * b[1] + a[1] * b[3]) % 1009, (a[2] * b[0] + a[3] * b[2]) % 1009,
+        (a[2] * b[1] + a[3] * b[3]) % 1009};
+  };
+  std::vector<Mat> ms;
+  for (long i = 0; i < 70000; ++i) {
+    ms.push_back({i % 5, 1, i % 3, 2});
+  }
+  auto a = iter::accumulate(ms, mul);
+  const std::vector<Mat> expected(std::begin(a), std::end(a));
+  REQUIRE(scan(ms, mul, 4) == expected);
+}
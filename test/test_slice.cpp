@@ -1,6 +1,12 @@
 #include <slice.hpp>
 
+#include <cstddef>
+#include <forward_list>
+#include <iterator>
+#include <list>
+#include <sstream>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -127,6 +133,183 @@ TEST_CASE("slice: invalid ranges give 0 size slices", "[slice]") {
   }
 }
 
+TEST_CASE("slice: negative start and stop count from the end", "[slice]") {
+  Vec ns = {10, 11, 12, 13, 14, 15, 16, 17, 18, 19};
+  const std::list<int> ls(ns.begin(), ns.end());
+  const std::forward_list<int> fl(ns.begin(), ns.end());
+
+  auto check = [&](int start, int stop, int step, Vec vc) {
+    // random access, sized but not random access, and neither
+    auto s1 = slice(ns, start, stop, step);
+    auto s2 = slice(ls, start, stop, step);
+    auto s3 = slice(fl, start, stop, step);
+    REQUIRE(Vec(std::begin(s1), std::end(s1)) == vc);
+    REQUIRE(Vec(std::begin(s2), std::end(s2)) == vc);
+    REQUIRE(Vec(std::begin(s3), std::end(s3)) == vc);
+    REQUIRE(s1.size() == vc.size());
+    REQUIRE(s2.size() == vc.size());
+  };
+
+  SECTION("negative start") {
+    check(-3, 10, 1, {17, 18, 19});
+  }
+  SECTION("negative stop") {
+    check(2, -5, 1, {12, 13, 14});
+  }
+  SECTION("both negative") {
+    check(-6, -1, 2, {14, 16, 18});
+  }
+  SECTION("negative start before the beginning") {
+    check(-20, 3, 1, {10, 11, 12});
+  }
+  SECTION("negative stop before the beginning") {
+    check(0, -20, 1, {});
+  }
+  SECTION("negative stop before start") {
+    check(-2, -5, 1, {});
+  }
+  SECTION("start at or after the resolved stop") {
+    check(8, -3, 1, {});
+  }
+  SECTION("negative stop with a step") {
+    check(1, -1, 3, {11, 14, 17});
+  }
+}
+
+namespace {
+  // a forward iterable without a size that counts how far it's walked
+  class CountedList {
+   private:
+    std::forward_list<int> ns_;
+    int* steps_;
+
+   public:
+    class Iterator {
+     private:
+      std::forward_list<int>::const_iterator it_;
+      int* steps_;
+
+     public:
+      using iterator_category = std::forward_iterator_tag;
+      using value_type = int;
+      using difference_type = std::ptrdiff_t;
+      using pointer = const int*;
+      using reference = const int&;
+
+      Iterator() = default;
+      Iterator(std::forward_list<int>::const_iterator it, int* steps)
+          : it_{it}, steps_{steps} {}
+
+      const int& operator*() const {
+        return *it_;
+      }
+
+      Iterator& operator++() {
+        ++*steps_;
+        ++it_;
+        return *this;
+      }
+
+      Iterator operator++(int) {
+        auto ret = *this;
+        ++*this;
+        return ret;
+      }
+
+      bool operator==(const Iterator& other) const {
+        return it_ == other.it_;
+      }
+
+      bool operator!=(const Iterator& other) const {
+        return it_ != other.it_;
+      }
+    };
+
+    CountedList(std::forward_list<int> ns, int* steps)
+        : ns_(std::move(ns)), steps_{steps} {}
+
+    Iterator begin() const {
+      return {ns_.begin(), steps_};
+    }
+
+    Iterator end() const {
+      return {ns_.end(), steps_};
+    }
+  };
+}
+
+TEST_CASE("slice: negative indices on unsized input walk it once",
+    "[slice]") {
+  std::forward_list<int> ns;
+  for (int i = 99; i >= 0; --i) {
+    ns.push_front(i);
+  }
+  int steps = 0;
+  const CountedList cl{std::move(ns), &steps};
+
+  SECTION("negative start") {
+    auto sl = slice(cl, -10, -2, 3);
+    Vec v(std::begin(sl), std::end(sl));
+    Vec vc = {90, 93, 96};
+    REQUIRE(v == vc);
+  }
+  SECTION("negative stop") {
+    auto sl = slice(cl, 95, -2);
+    Vec v(std::begin(sl), std::end(sl));
+    Vec vc = {95, 96, 97};
+    REQUIRE(v == vc);
+  }
+  REQUIRE(steps == 100);
+}
+
+TEST_CASE("slice: works with single-pass input", "[slice]") {
+  std::istringstream in{"1 2 3 4 5 6 7 8 9 10"};
+  struct IntStream {
+    std::istringstream& in;
+    std::istream_iterator<int> begin() {
+      return std::istream_iterator<int>{in};
+    }
+    std::istream_iterator<int> end() {
+      return {};
+    }
+  } s{in};
+  auto sl = slice(s, 2, 8, 2);
+  Vec v(std::begin(sl), std::end(sl));
+  Vec vc = {3, 5, 7};
+  REQUIRE(v == vc);
+}
+
+TEST_CASE("slice: random access input gives random access iterators",
+    "[slice]") {
+  std::vector<int> ns(2000000);
+  for (std::size_t i = 0; i < ns.size(); ++i) {
+    ns[i] = static_cast<int>(i);
+  }
+  auto sl = slice(ns, 1000000, -2, 3);
+  using It = decltype(std::begin(sl));
+  REQUIRE(std::is_same<std::iterator_traits<It>::iterator_category,
+      std::random_access_iterator_tag>::value);
+
+  auto it = std::begin(sl);
+  REQUIRE(*it == 1000000);
+  REQUIRE(it[2] == 1000006);
+  REQUIRE(*(it + 5) == 1000015);
+  REQUIRE(std::end(sl) - it == 333333);
+  REQUIRE(sl.size() == 333333);
+  REQUIRE(*(std::end(sl) - 1) == 1999996);
+  REQUIRE(it < std::end(sl));
+  it += 10;
+  --it;
+  REQUIRE(*it == 1000027);
+
+  // writes go through to the input
+  *it = -1;
+  REQUIRE(ns[1000027] == -1);
+
+  const auto& csl = sl;
+  REQUIRE(std::end(csl) - std::begin(sl) == 333333);
+}
+
 TEST_CASE("slice: moves rvalues and binds to lvalues", "[slice]") {
   itertest::BasicIterable<int> bi{1, 2, 3, 4};
   slice(bi, 1, 3);
@@ -9,6 +9,7 @@
 #include "helpers.hpp"
 
 using iter::takewhile;
+using iter::takewhile_partitioned;
 using Vec = const std::vector<int>;
 
 namespace {
@@ -192,3 +193,91 @@ TEST_CASE("takewhile: has correct ctor and assign ops", "[takewhile]") {
   REQUIRE(itertest::IsMoveConstructibleOnly<T1>::value);
   REQUIRE(itertest::IsMoveConstructibleOnly<T2>::value);
 }
+
+TEST_CASE("takewhile_partitioned: matches takewhile on partitioned input",
+    "[takewhile_partitioned]") {
+  Vec ns = {1, 3, 5, 20, 22, 40};
+  auto tp = takewhile_partitioned(under_ten, ns);
+  Vec v(std::begin(tp), std::end(tp));
+  Vec vc = {1, 3, 5};
+  REQUIRE(v == vc);
+  REQUIRE(tp.size() == vc.size());
+
+  auto tw = takewhile(under_ten, ns);
+  REQUIRE(v == Vec(std::begin(tw), std::end(tw)));
+}
+
+TEST_CASE("takewhile_partitioned: all true, all false, and empty",
+    "[takewhile_partitioned]") {
+  Vec all_true = {1, 2, 3};
+  Vec all_false = {10, 20};
+  Vec empty{};
+  for (auto&& ns : {all_true, all_false, empty}) {
+    auto tp = takewhile_partitioned(under_ten, ns);
+    auto tw = takewhile(under_ten, ns);
+    Vec v(std::begin(tp), std::end(tp));
+    REQUIRE(v == Vec(std::begin(tw), std::end(tw)));
+    REQUIRE(tp.size() == v.size());
+  }
+}
+
+TEST_CASE("takewhile_partitioned: calls the predicate O(log n) times",
+    "[takewhile_partitioned]") {
+  std::vector<int> ns(1 << 20);
+  for (std::size_t i = 0; i < ns.size(); ++i) {
+    ns[i] = static_cast<int>(i);
+  }
+  int calls = 0;
+  auto tp = takewhile_partitioned(
+      [&calls](int i) {
+        ++calls;
+        return i < 1000;
+      },
+      ns);
+  REQUIRE(tp.size() == 1000);
+  REQUIRE(calls <= 21);
+
+  // the split is only looked for once
+  auto it = std::begin(tp);
+  REQUIRE(*(it + 10) == 10);
+  REQUIRE(std::end(tp) - it == 1000);
+  REQUIRE(calls <= 21);
+}
+
+TEST_CASE("takewhile_partitioned: const iteration",
+    "[takewhile_partitioned][const]") {
+  Vec ns = {1, 3, 5, 20, 22, 40};
+  const auto tp = takewhile_partitioned(under_ten, ns);
+  Vec v(std::begin(tp), std::end(tp));
+  Vec vc = {1, 3, 5};
+  REQUIRE(v == vc);
+}
+
+TEST_CASE("takewhile_partitioned: yields references to the input",
+    "[takewhile_partitioned]") {
+  std::vector<int> ns = {1, 3, 5, 20, 22, 40};
+  for (auto&& i : takewhile_partitioned(under_ten, ns)) {
+    i = 0;
+  }
+  std::vector<int> vc = {0, 0, 0, 20, 22, 40};
+  REQUIRE(ns == vc);
+}
+
+TEST_CASE("takewhile_partitioned: works with pipe and owns rvalues",
+    "[takewhile_partitioned]") {
+  auto tp = std::vector<int>{1, 3, 5, 20, 22, 40}
+            | takewhile_partitioned(under_ten);
+  auto moved = std::move(tp);
+  Vec v(std::begin(moved), std::end(moved));
+  Vec vc = {1, 3, 5};
+  REQUIRE(v == vc);
+}
+
+TEST_CASE("takewhile_partitioned: uses bool conversion without a predicate",
+    "[takewhile_partitioned]") {
+  Vec ns = {3, 2, 1, 0, 0};
+  auto tp = takewhile_partitioned(ns);
+  Vec v(std::begin(tp), std::end(tp));
+  Vec vc = {3, 2, 1};
+  REQUIRE(v == vc);
+}
@@ -0,0 +1,140 @@
+#include <filter.hpp>
+#include <imap.hpp>
+#include <range.hpp>
+#include <top_k.hpp>
+
+#include "helpers.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "catch.hpp"
+
+using iter::top_k;
+using iter::top_k_by;
+
+TEST_CASE("top_k: gives the k greatest, greatest first", "[top_k]") {
+  const std::vector<int> ns = {5, 1, 9, 3, 7, 2, 8};
+  const std::vector<int> expected = {9, 8, 7};
+  SECTION("Normal call") {
+    REQUIRE(top_k(ns, 3) == expected);
+  }
+  SECTION("Pipe") {
+    REQUIRE((ns | top_k(3)) == expected);
+  }
+  SECTION("Not random access") {
+    std::list<int> ls(ns.begin(), ns.end());
+    REQUIRE(top_k(ls, 3) == expected);
+  }
+}
+
+TEST_CASE("top_k: with a comparison", "[top_k]") {
+  const std::vector<int> ns = {5, 1, 9, 3, 7, 2, 8};
+  const std::vector<int> expected = {1, 2, 3};
+  SECTION("Normal call") {
+    REQUIRE(top_k(ns, 3, std::greater<>{}) == expected);
+  }
+  SECTION("Pipe") {
+    REQUIRE((ns | top_k(3, std::greater<>{})) == expected);
+  }
+}
+
+TEST_CASE("top_k: k larger than the input gives all of it sorted",
+    "[top_k]") {
+  const std::vector<int> ns = {2, 3, 1};
+  const std::vector<int> expected = {3, 2, 1};
+  REQUIRE(top_k(ns, 10) == expected);
+  REQUIRE(top_k(ns, 0).empty());
+  REQUIRE(top_k(std::vector<int>{}, 3).empty());
+}
+
+TEST_CASE("top_k: works with pipelines that aren't sized", "[top_k]") {
+  auto odd_squares = iter::imap([](int i) { return i * i; },
+      iter::filter([](int i) { return i % 2 == 1; }, iter::range(100)));
+  const std::vector<int> expected = {99 * 99, 97 * 97, 95 * 95};
+  REQUIRE(top_k(odd_squares, 3) == expected);
+}
+
+TEST_CASE("top_k: works with input iterators", "[top_k]") {
+  itertest::InputIterable seq;
+  REQUIRE(top_k(seq, 2).size() == 2);
+}
+
+TEST_CASE("top_k: split between threads", "[top_k]") {
+  std::vector<int> ns(300000);
+  std::mt19937 gen{12};
+  for (auto& n : ns) {
+    n = static_cast<int>(gen() % 1000000);
+  }
+  std::vector<int> expected = ns;
+  std::sort(expected.begin(), expected.end(), std::greater<>{});
+  expected.resize(100);
+  for (std::size_t threads : {1, 2, 4, 7}) {
+    REQUIRE(top_k(ns, 100, std::less<>{}, threads) == expected);
+    REQUIRE((ns | top_k(100, std::less<>{}, threads)) == expected);
+  }
+}
+
+TEST_CASE("top_k_by: compares keys", "[top_k_by]") {
+  const std::vector<std::string> strs = {
+      "a", "abcd", "ab", "abcdef", "abc", "abcde"};
+  const std::vector<std::string> expected = {"abcdef", "abcde"};
+  auto size = [](const std::string& s) { return s.size(); };
+  SECTION("Normal call") {
+    REQUIRE(top_k_by(strs, 2, size) == expected);
+  }
+  SECTION("Pipe") {
+    REQUIRE((strs | top_k_by(2, size)) == expected);
+  }
+  SECTION("Pointer to member") {
+    REQUIRE(top_k_by(strs, 2, &std::string::size) == expected);
+  }
+}
+
+TEST_CASE("top_k_by: calls the key function once per element",
+    "[top_k_by]") {
+  const std::vector<int> ns = {4, 8, 1, 9, 2, 7};
+  int calls = 0;
+  auto key = [&calls](int i) {
+    ++calls;
+    return -i;
+  };
+  const std::vector<int> expected = {1, 2};
+  REQUIRE(top_k_by(ns, 2, key) == expected);
+  REQUIRE(calls == static_cast<int>(ns.size()));
+}
+
+TEST_CASE("top_k_by: split between threads", "[top_k_by]") {
+  std::vector<int> ns(100000);
+  for (std::size_t i = 0; i < ns.size(); ++i) {
+    ns[i] = static_cast<int>((i * 7919) % ns.size());
+  }
+  auto key = [](int i) { return i % 1000; };
+  auto is_top = [](int i) { return i % 1000 == 999; };
+  auto result = top_k_by(ns, 50, key, 4);
+  REQUIRE(result.size() == 50);
+  REQUIRE(std::all_of(result.begin(), result.end(), is_top));
+  auto piped = ns | top_k_by(50, key, 4);
+  REQUIRE(piped.size() == 50);
+  REQUIRE(std::all_of(piped.begin(), piped.end(), is_top));
+}
+
+TEST_CASE("top_k_by: stays on the calling thread by default",
+    "[top_k_by]") {
+  const std::vector<int> ns(100000, 1);
+  const auto caller = std::this_thread::get_id();
+  bool other_thread = false;
+  auto key = [&](int i) {
+    other_thread = other_thread || std::this_thread::get_id() != caller;
+    return i;
+  };
+  REQUIRE(top_k_by(ns, 3, key).size() == 3);
+  REQUIRE((ns | top_k_by(3, key)).size() == 3);
+  REQUIRE_FALSE(other_thread);
+}
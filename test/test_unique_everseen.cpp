@@ -4,6 +4,8 @@
 
 #include <iterator>
 #include <string>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "catch.hpp"
@@ -62,6 +64,107 @@ TEST_CASE(
   REQUIRE(bi.was_moved_from());
 }
 
+TEST_CASE("unique everseen: with a capacity hint", "[unique_everseen]") {
+  Vec ns = {1, 2, 3, 4, 3, 2, 1, 5, 6};
+  auto ue = unique_everseen(ns, 6);
+  Vec v(std::begin(ue), std::end(ue));
+  Vec vc = {1, 2, 3, 4, 5, 6};
+  REQUIRE(v == vc);
+}
+
+TEST_CASE("unique everseen: with a key function", "[unique_everseen]") {
+  const std::vector<std::string> ss = {
+      "apple", "avocado", "banana", "blueberry", "cherry", "apricot"};
+  auto first_letter = [](const std::string& s) { return s[0]; };
+  std::vector<std::string> v;
+  SECTION("Normal call") {
+    auto ue = unique_everseen(first_letter, ss);
+    v.assign(std::begin(ue), std::end(ue));
+  }
+  SECTION("With a capacity hint") {
+    auto ue = unique_everseen(first_letter, ss, 3);
+    v.assign(std::begin(ue), std::end(ue));
+  }
+  SECTION("Pipe") {
+    auto ue = ss | unique_everseen(first_letter);
+    v.assign(std::begin(ue), std::end(ue));
+  }
+  const std::vector<std::string> vc = {"apple", "banana", "cherry"};
+  REQUIRE(v == vc);
+}
+
+TEST_CASE("unique everseen: many values", "[unique_everseen]") {
+  std::vector<long> ns;
+  for (long i = 0; i < 100000; ++i) {
+    ns.push_back((i * 7919) % 30011);
+  }
+  std::vector<long> vc;
+  std::unordered_set<long> seen;
+  for (auto n : ns) {
+    if (seen.insert(n).second) {
+      vc.push_back(n);
+    }
+  }
+  auto ue = unique_everseen(ns);
+  std::vector<long> v(std::begin(ue), std::end(ue));
+  REQUIRE(v == vc);
+}
+
+namespace {
+  // counts how many times any CopyCounted has been copied
+  struct CopyCounted {
+    static int copies;
+    std::string s;
+    CopyCounted(std::string in_s) : s{std::move(in_s)} {}
+    CopyCounted(const CopyCounted& other) : s{other.s} {
+      ++copies;
+    }
+    CopyCounted& operator=(const CopyCounted&) = default;
+    bool operator==(const CopyCounted& other) const {
+      return s == other.s;
+    }
+  };
+  int CopyCounted::copies = 0;
+}
+
+namespace std {
+  template <>
+  struct hash<CopyCounted> {
+    std::size_t operator()(const CopyCounted& c) const {
+      return std::hash<std::string>{}(c.s);
+    }
+  };
+}
+
+TEST_CASE("unique everseen: doesn't copy elements of const lvalue containers",
+    "[unique_everseen]") {
+  std::vector<CopyCounted> cs;
+  for (auto s : {"a", "b", "a", "c", "b", "d"}) {
+    cs.emplace_back(s);
+  }
+  CopyCounted::copies = 0;
+  auto ue = unique_everseen(std::as_const(cs));
+  std::vector<std::string> v;
+  for (auto&& c : ue) {
+    v.push_back(c.s);
+  }
+  REQUIRE(v == std::vector<std::string>{"a", "b", "c", "d"});
+  REQUIRE(CopyCounted::copies == 0);
+}
+
+TEST_CASE("unique everseen: changing yielded elements doesn't change the set",
+    "[unique_everseen]") {
+  std::vector<std::string> ss{"a-long-string-that-is-not-inlined-xxxxxxxx",
+      "b", "a-long-string-that-is-not-inlined-xxxxxxxx"};
+  std::vector<std::string> v;
+  for (auto&& s : unique_everseen(ss)) {
+    v.push_back(s);
+    s += "!";
+  }
+  REQUIRE(v.size() == 2);
+  REQUIRE(v[1] == "b");
+}
+
 TEST_CASE("unique everseen: Works with different begin and end types",
     "[unique_everseen]") {
   CharRange cr{'d'};
@@ -0,0 +1,83 @@
+#include <unique_everseen_approx.hpp>
+
+#include "helpers.hpp"
+
+#include <iterator>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "catch.hpp"
+
+using iter::unique_everseen_approx;
+
+using Vec = const std::vector<int>;
+
+TEST_CASE("unique_everseen_approx: nonadjacent repeating values",
+    "[unique_everseen_approx]") {
+  Vec ns = {1, 2, 3, 4, 3, 2, 1, 5, 6};
+  std::vector<int> v;
+  SECTION("Normal call") {
+    auto ue = unique_everseen_approx(ns, 100);
+    v.assign(std::begin(ue), std::end(ue));
+  }
+  SECTION("With a false positive rate") {
+    auto ue = unique_everseen_approx(ns, 100, 0.0001);
+    v.assign(std::begin(ue), std::end(ue));
+  }
+  SECTION("Pipe") {
+    auto ue = ns | unique_everseen_approx(100);
+    v.assign(std::begin(ue), std::end(ue));
+  }
+  SECTION("Pipe with a false positive rate") {
+    auto ue = ns | unique_everseen_approx(100, 0.0001);
+    v.assign(std::begin(ue), std::end(ue));
+  }
+  Vec vc = {1, 2, 3, 4, 5, 6};
+  REQUIRE(v == vc);
+}
+
+TEST_CASE("unique_everseen_approx: strings", "[unique_everseen_approx]") {
+  const std::vector<std::string> ss = {"a", "b", "a", "c", "b"};
+  auto ue = unique_everseen_approx(ss, 10);
+  std::vector<std::string> v(std::begin(ue), std::end(ue));
+  REQUIRE(v == std::vector<std::string>{"a", "b", "c"});
+}
+
+TEST_CASE("unique_everseen_approx: never repeats and rarely drops",
+    "[unique_everseen_approx]") {
+  constexpr int distinct = 100000;
+  std::vector<int> ns;
+  for (int i = 0; i < distinct; ++i) {
+    ns.push_back(i);
+    ns.push_back(i / 2);
+  }
+  auto ue = unique_everseen_approx(ns, distinct, 0.01);
+  std::vector<int> v(std::begin(ue), std::end(ue));
+  std::set<int> s(v.begin(), v.end());
+  REQUIRE(s.size() == v.size());
+  // allow for some slack over the 1% target
+  REQUIRE(v.size() > distinct * 97 / 100);
+}
+
+TEST_CASE("unique_everseen_approx: empty", "[unique_everseen_approx]") {
+  auto ue = unique_everseen_approx(Vec{}, 0);
+  REQUIRE(std::begin(ue) == std::end(ue));
+}
+
+TEST_CASE("unique_everseen_approx: binds to lvalues, moves rvalues",
+    "[unique_everseen_approx]") {
+  itertest::BasicIterable<int> bi{1, 2};
+  unique_everseen_approx(bi, 2);
+  REQUIRE_FALSE(bi.was_moved_from());
+
+  unique_everseen_approx(std::move(bi), 2);
+  REQUIRE(bi.was_moved_from());
+}
+
+TEST_CASE("unique_everseen_approx: iterator meets requirements",
+    "[unique_everseen_approx]") {
+  std::string s{};
+  auto c = unique_everseen_approx(s, 1);
+  REQUIRE(itertest::IsIterator<decltype(std::begin(c))>::value);
+}
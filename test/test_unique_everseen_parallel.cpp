@@ -0,0 +1,77 @@
+#include <unique_everseen_parallel.hpp>
+#include <unique_everseen.hpp>
+
+#include "helpers.hpp"
+
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "catch.hpp"
+
+using iter::unique_everseen_parallel;
+
+using Vec = const std::vector<int>;
+
+TEST_CASE("unique_everseen_parallel: nonadjacent repeating values",
+    "[unique_everseen_parallel]") {
+  Vec ns = {1, 2, 3, 4, 3, 2, 1, 5, 6};
+  std::vector<int> v;
+  SECTION("Normal call") {
+    auto ue = unique_everseen_parallel(ns);
+    v.assign(std::begin(ue), std::end(ue));
+  }
+  SECTION("With thread count") {
+    auto ue = unique_everseen_parallel(ns, 4);
+    v.assign(std::begin(ue), std::end(ue));
+  }
+  SECTION("Pipe") {
+    auto ue = ns | unique_everseen_parallel;
+    v.assign(std::begin(ue), std::end(ue));
+  }
+  SECTION("Pipe with thread count") {
+    auto ue = ns | unique_everseen_parallel(2);
+    v.assign(std::begin(ue), std::end(ue));
+  }
+  Vec vc = {1, 2, 3, 4, 5, 6};
+  REQUIRE(v == vc);
+}
+
+TEST_CASE("unique_everseen_parallel: empty", "[unique_everseen_parallel]") {
+  auto ue = unique_everseen_parallel(Vec{}, 4);
+  REQUIRE(std::begin(ue) == std::end(ue));
+}
+
+TEST_CASE("unique_everseen_parallel: matches unique_everseen",
+    "[unique_everseen_parallel]") {
+  std::vector<std::string> ss;
+  for (long i = 0; i < 200003; ++i) {
+    ss.push_back(std::to_string((i * 7919) % 50021));
+  }
+  auto serial = iter::unique_everseen(ss);
+  const std::vector<std::string> expected(
+      std::begin(serial), std::end(serial));
+
+  for (std::size_t threads : {1, 2, 3, 4, 8}) {
+    auto ue = unique_everseen_parallel(ss, threads);
+    std::vector<std::string> v(std::begin(ue), std::end(ue));
+    REQUIRE(v == expected);
+    REQUIRE(ue.size() == expected.size());
+  }
+}
+
+TEST_CASE("unique_everseen_parallel: yields references",
+    "[unique_everseen_parallel]") {
+  std::vector<int> ns = {1, 2, 1, 3};
+  for (auto&& i : unique_everseen_parallel(ns)) {
+    i *= 10;
+  }
+  REQUIRE(ns == Vec{10, 20, 1, 30});
+}
+
+TEST_CASE("unique_everseen_parallel: moves rvalues",
+    "[unique_everseen_parallel]") {
+  auto ue = unique_everseen_parallel(std::vector<std::string>{"a", "b", "a"});
+  std::vector<std::string> v(std::begin(ue), std::end(ue));
+  REQUIRE(v == std::vector<std::string>{"a", "b"});
+}
@@ -2,7 +2,9 @@
 
 #include "helpers.hpp"
 
+#include <initializer_list>
 #include <iterator>
+#include <list>
 #include <sstream>
 #include <string>
 #include <tuple>
@@ -87,6 +89,89 @@ TEST_CASE("zip: Empty", "[zip]") {
   REQUIRE_FALSE(std::begin(z) != std::end(z));
 }
 
+TEST_CASE("zip: sized random access iterables", "[zip]") {
+  using Tu = std::tuple<int, char>;
+  using ResVec = const std::vector<Tu>;
+  std::vector<int> iv{10, 20, 30, 40};
+  std::string s{"hey"};
+
+  SECTION("Terminates on shortest") {
+    auto z = zip(iv, s);
+    ResVec v(std::begin(z), std::end(z));
+    ResVec vc{Tu{10, 'h'}, Tu{20, 'e'}, Tu{30, 'y'}};
+    REQUIRE(v == vc);
+  }
+
+  SECTION("Mixed with non-random access") {
+    std::list<char> li{'a', 'b'};
+    auto z = zip(iv, li);
+    REQUIRE(std::distance(std::begin(z), std::end(z)) == 2);
+  }
+
+  SECTION("One empty") {
+    auto z = zip(iv, std::string{});
+    REQUIRE(std::begin(z) == std::end(z));
+  }
+}
+
+namespace {
+  // sized and random access, but with an end of a different type
+  class SentinelVec {
+   private:
+    std::vector<int> v_;
+
+   public:
+    struct Sentinel {
+      std::vector<int>::const_iterator end;
+    };
+
+    SentinelVec(std::initializer_list<int> il) : v_(il) {}
+
+    std::vector<int>::const_iterator begin() const {
+      return v_.begin();
+    }
+
+    Sentinel end() const {
+      return {v_.end()};
+    }
+
+    std::size_t size() const {
+      return v_.size();
+    }
+
+    friend bool operator!=(
+        const std::vector<int>::const_iterator& it, const Sentinel& s) {
+      return it != s.end;
+    }
+
+    friend bool operator!=(
+        const Sentinel& s, const std::vector<int>::const_iterator& it) {
+      return it != s.end;
+    }
+  };
+}
+
+TEST_CASE("zip: sized random access iterables with a sentinel end", "[zip]") {
+  using Tu = std::tuple<int, char>;
+  using ResVec = const std::vector<Tu>;
+  SentinelVec sv{10, 20, 30, 40};
+  std::string s{"hey"};
+  auto z = zip(sv, s);
+  ResVec v(std::begin(z), std::end(z));
+  ResVec vc{Tu{10, 'h'}, Tu{20, 'e'}, Tu{30, 'y'}};
+  REQUIRE(v == vc);
+  REQUIRE(z.size() == 3);
+}
+
+TEST_CASE("zip: size()", "[zip]") {
+  std::vector<int> iv{10, 20, 30, 40};
+  std::string s{"hey"};
+  std::list<char> li{'a', 'b'};
+  REQUIRE(zip(iv, s).size() == 3);
+  REQUIRE(zip(iv, s, li).size() == 2);
+  REQUIRE(zip(iv, std::vector<int>{}).size() == 0);
+}
+
 TEST_CASE("zip: Modify sequence through zip", "[zip]") {
   std::vector<int> iv{1, 2, 3};
   std::vector<int> iv2{1, 2, 3, 4};
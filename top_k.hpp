@@ -0,0 +1,234 @@
+#ifndef ITER_TOP_K_HPP_
+#define ITER_TOP_K_HPP_
+
+#include "internal/iterbase.hpp"
+#include "internal/parallel.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace iter {
+  namespace impl {
+    // Keeps the k greatest values pushed into it, according to compare, in
+    // a heap with the least of them at the front, so a new value only has
+    // to beat the front to get in.  compare may also be called with the
+    // front and something other than a T, to check a value before
+    // building a T from it.
+    template <typename T, typename Compare>
+    class BoundedHeap {
+     private:
+      std::size_t k_;
+      Compare compare_;
+      std::vector<T> heap_;
+
+      auto heap_order() {
+        return [this](const T& lhs, const T& rhs) {
+          return std::invoke(compare_, rhs, lhs);
+        };
+      }
+
+     public:
+      BoundedHeap(std::size_t k, Compare compare)
+          : k_{k}, compare_(std::move(compare)) {}
+
+      // whether a value would be kept if it were pushed now
+      template <typename U>
+      bool wants(const U& u) {
+        return heap_.size() < k_
+               || (k_ > 0 && std::invoke(compare_, heap_.front(), u));
+      }
+
+      // must only be called when wants() is true for value
+      template <typename U>
+      void push(U&& value) {
+        if (heap_.size() < k_) {
+          heap_.emplace_back(std::forward<U>(value));
+        } else {
+          std::pop_heap(heap_.begin(), heap_.end(), heap_order());
+          heap_.back() = std::forward<U>(value);
+        }
+        std::push_heap(heap_.begin(), heap_.end(), heap_order());
+      }
+
+      void merge(BoundedHeap&& other) {
+        for (auto&& value : other.heap_) {
+          if (wants(value)) {
+            push(std::move(value));
+          }
+        }
+      }
+
+      // the values kept, greatest first
+      std::vector<T> take_sorted() {
+        std::sort_heap(heap_.begin(), heap_.end(), heap_order());
+        return std::move(heap_);
+      }
+    };
+
+    // orders (key, element) pairs by key.  Also compares a pair to a key
+    struct FirstLess {
+      template <typename T, typename U>
+      bool operator()(const std::pair<T, U>& lhs,
+          const std::pair<T, U>& rhs) const {
+        return lhs.first < rhs.first;
+      }
+
+      template <typename T, typename U, typename Key>
+      bool operator()(const std::pair<T, U>& lhs, const Key& key) const {
+        return lhs.first < key;
+      }
+    };
+
+    // Runs feed(heap, first, last) over the container's iterators, either
+    // in one go or, for sized random access containers large enough to be
+    // worth it, over one block per thread with a heap each.  The heaps are
+    // then merged into one.
+    template <typename Heap, typename Container, typename Feed>
+    Heap top_k_heap(Container& container, Heap heap, std::size_t num_threads,
+        Feed feed) {
+      if constexpr (is_indexable<Container>) {
+        const std::size_t size = std::size(container);
+        const std::size_t num_blocks =
+            std::min<std::size_t>(num_threads, size / MIN_PARALLEL_BLOCK_SIZE);
+        if (num_blocks > 1) {
+          using Diff = typename std::iterator_traits<
+              iterator_type<Container>>::difference_type;
+          const std::size_t block_size = (size + num_blocks - 1) / num_blocks;
+          auto first = get_begin(container);
+          std::vector<Heap> heaps(num_blocks, heap);
+          run_parallel(num_blocks, [&](std::size_t b) {
+            const std::size_t start = std::min(b * block_size, size);
+            const std::size_t stop = std::min(start + block_size, size);
+            feed(heaps[b], first + static_cast<Diff>(start),
+                first + static_cast<Diff>(stop));
+          });
+          for (std::size_t b = 1; b < num_blocks; ++b) {
+            heaps[0].merge(std::move(heaps[b]));
+          }
+          return std::move(heaps[0]);
+        }
+      }
+      feed(heap, get_begin(container), get_end(container));
+      return heap;
+    }
+
+    struct TopKFn;
+    struct TopKByFn;
+  }
+}
+
+// top_k gives the k greatest elements according to a less-than comparison,
+// greatest first, in a std::vector.  It makes one pass holding at most k
+// elements, in a heap whose least element is at the front, so most elements
+// are only compared against that one and never copied.  When asked for more
+// than one thread, sized random access inputs that are large enough are
+// split into one block per thread, each with its own heap, and the heaps are
+// merged at the end.  The comparison is then called from several threads
+// at once.  Which of several equal elements are kept is unspecified.
+struct iter::impl::TopKFn : Pipeable<TopKFn> {
+ private:
+  template <typename Compare>
+  struct FnPartial : Pipeable<FnPartial<Compare>> {
+    std::size_t k;
+    Compare compare;
+    std::size_t num_threads;
+
+    template <typename Container>
+    auto operator()(Container&& container) const {
+      return TopKFn{}(
+          std::forward<Container>(container), k, compare, num_threads);
+    }
+  };
+
+ public:
+  template <typename Container, typename Compare = std::less<>,
+      typename = std::enable_if_t<is_iterable<Container>>>
+  auto operator()(Container&& container, std::size_t k, Compare compare = {},
+      std::size_t num_threads = 1) const {
+    using Elem = std::decay_t<iterator_deref<Container>>;
+    using Heap = BoundedHeap<Elem, Compare>;
+    return top_k_heap(container, Heap{k, compare}, num_threads,
+        [](Heap& heap, auto it, auto end_it) {
+          for (; it != end_it; ++it) {
+            decltype(auto) e = *it;
+            if (heap.wants(e)) {
+              heap.push(std::forward<decltype(e)>(e));
+            }
+          }
+        })
+        .take_sorted();
+  }
+
+  template <typename Compare = std::less<>>
+  FnPartial<Compare> operator()(std::size_t k, Compare compare = {},
+      std::size_t num_threads = 1) const {
+    return {{}, k, std::move(compare), num_threads};
+  }
+};
+
+// top_k_by is top_k comparing the result of a key function on each element
+// with <.  The key function is called once per element, and from several
+// threads at once when more than one thread is asked for.
+struct iter::impl::TopKByFn : Pipeable<TopKByFn> {
+ private:
+  template <typename KeyFunc>
+  struct FnPartial : Pipeable<FnPartial<KeyFunc>> {
+    std::size_t k;
+    KeyFunc key_func;
+    std::size_t num_threads;
+
+    template <typename Container>
+    auto operator()(Container&& container) const {
+      return TopKByFn{}(
+          std::forward<Container>(container), k, key_func, num_threads);
+    }
+  };
+
+ public:
+  template <typename Container, typename KeyFunc,
+      typename = std::enable_if_t<is_iterable<Container>>>
+  auto operator()(Container&& container, std::size_t k, KeyFunc key_func,
+      std::size_t num_threads = 1) const {
+    using Elem = std::decay_t<iterator_deref<Container>>;
+    using Key =
+        std::decay_t<std::invoke_result_t<KeyFunc&, iterator_deref<Container>>>;
+    using Heap = BoundedHeap<std::pair<Key, Elem>, FirstLess>;
+    auto kept = top_k_heap(container, Heap{k, {}}, num_threads,
+        [&key_func](Heap& heap, auto it, auto end_it) {
+          for (; it != end_it; ++it) {
+            decltype(auto) e = *it;
+            decltype(auto) key = std::invoke(key_func, e);
+            if (heap.wants(key)) {
+              heap.push(std::pair<Key, Elem>(std::forward<decltype(key)>(key),
+                  std::forward<decltype(e)>(e)));
+            }
+          }
+        })
+        .take_sorted();
+    std::vector<Elem> result;
+    result.reserve(kept.size());
+    for (auto&& key_elem : kept) {
+      result.push_back(std::move(key_elem.second));
+    }
+    return result;
+  }
+
+  template <typename KeyFunc,
+      typename = std::enable_if_t<!is_iterable<KeyFunc>>>
+  FnPartial<std::decay_t<KeyFunc>> operator()(std::size_t k,
+      KeyFunc&& key_func, std::size_t num_threads = 1) const {
+    return {{}, k, std::forward<KeyFunc>(key_func), num_threads};
+  }
+};
+
+namespace iter {
+  constexpr impl::TopKFn top_k{};
+  constexpr impl::TopKByFn top_k_by{};
+}
+
+#endif
@@ -2,26 +2,114 @@
 #define ITER_UNIQUE_EVERSEEN_HPP_
 
 #include "filter.hpp"
+#include "internal/flat_hash_set.hpp"
 #include "internal/iterbase.hpp"
 
+#include <cstddef>
 #include <functional>
 #include <iterator>
+#include <memory>
 #include <type_traits>
-#include <unordered_set>
 #include <utility>
 
 namespace iter {
   namespace impl {
-    struct UniqueEverseenFn : Pipeable<UniqueEverseenFn> {
-      template <typename Container>
-      auto operator()(Container&& container) const {
+    // What unique_everseen stores for each distinct element of an lvalue
+    // container, in place of a copy of it
+    template <typename T>
+    struct ElemRef {
+      const T* elem;
+      std::size_t hash;
+    };
+
+    struct ElemRefHash {
+      template <typename T>
+      std::size_t operator()(const ElemRef<T>& ref) const {
+        return ref.hash;
+      }
+    };
+
+    struct ElemRefEqual {
+      template <typename T>
+      bool operator()(const ElemRef<T>& lhs, const ElemRef<T>& rhs) const {
+        return lhs.hash == rhs.hash && *lhs.elem == *rhs.elem;
+      }
+    };
+
+    // Elements of a container that is bound by reference stay where they
+    // are, so unique_everseen can point at them instead of copying them.
+    // Only done when the elements are yielded as const references, since
+    // otherwise the loop could change an element that is already in the
+    // set.  Also only for forward iterators, which guarantee their
+    // references aren't into the iterator itself or a buffer it reuses, and
+    // for elements bigger than the ElemRef.
+    template <typename Container, typename = void>
+    struct StoresElemRefs : std::false_type {};
+
+    template <typename Container>
+    struct StoresElemRefs<Container,
+        std::enable_if_t<std::is_lvalue_reference_v<Container>
+                         && std::is_lvalue_reference_v<
+                                iterator_deref<Container>>
+                         && std::is_const_v<std::remove_reference_t<
+                                iterator_deref<Container>>>>>
+        : std::bool_constant<
+              is_forward_iter<iterator_type<Container>>::value
+              && !(std::is_trivially_copyable_v<
+                       std::decay_t<iterator_deref<Container>>>
+                     && sizeof(std::decay_t<iterator_deref<Container>>)
+                            <= sizeof(ElemRef<int>))> {};
+
+    // Yields the elements whose key (the element itself, or the result of
+    // the key function) hasn't been seen before.  Seen keys are kept in a
+    // FlatHashSet, which can be given a hint of how many distinct keys to
+    // expect so it doesn't need to grow along the way.
+    struct UniqueEverseenFn : PipeableAndBindFirst<UniqueEverseenFn> {
+      template <typename Container,
+          typename = std::enable_if_t<is_iterable<Container>>>
+      auto operator()(Container&& container, std::size_t expected = 0) const {
         using elem_type = impl::iterator_deref<Container>;
-        auto func = [elem_seen = std::unordered_set<std::decay_t<elem_type>>()](
+        using Elem = std::decay_t<elem_type>;
+        if constexpr (StoresElemRefs<Container>::value) {
+          FlatHashSet<ElemRef<Elem>, ElemRefHash, ElemRefEqual> elem_seen;
+          elem_seen.reserve(expected);
+          auto func = [elem_seen = std::move(elem_seen)](
+              const std::remove_reference_t<elem_type>& e) mutable {
+            return elem_seen.insert(
+                ElemRef<Elem>{std::addressof(e), std::hash<Elem>{}(e)});
+          };
+          return filter(func, std::forward<Container>(container));
+        } else {
+          FlatHashSet<Elem> elem_seen;
+          elem_seen.reserve(expected);
+          auto func = [elem_seen = std::move(elem_seen)](
+              const std::remove_reference_t<elem_type>& e) mutable {
+            return elem_seen.insert(e);
+          };
+          return filter(func, std::forward<Container>(container));
+        }
+      }
+
+      // only the keys are stored, not the elements
+      template <typename KeyFunc, typename Container,
+          typename = std::enable_if_t<!is_iterable<KeyFunc>
+                                      && is_iterable<Container>>>
+      auto operator()(KeyFunc key_func, Container&& container,
+          std::size_t expected = 0) const {
+        using elem_type = impl::iterator_deref<Container>;
+        using key_type = std::decay_t<std::invoke_result_t<KeyFunc&,
+            const std::remove_reference_t<elem_type>&>>;
+        FlatHashSet<key_type> key_seen;
+        key_seen.reserve(expected);
+        auto func = [key_seen = std::move(key_seen),
+                        key_func = std::move(key_func)](
             const std::remove_reference_t<elem_type>& e) mutable {
-          return elem_seen.insert(e).second;
+          return key_seen.insert(std::invoke(key_func, e));
         };
         return filter(func, std::forward<Container>(container));
       }
+
+      using PipeableAndBindFirst<UniqueEverseenFn>::operator();
     };
   }
 
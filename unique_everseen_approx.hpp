@@ -0,0 +1,128 @@
+#ifndef ITER_UNIQUE_EVERSEEN_APPROX_HPP_
+#define ITER_UNIQUE_EVERSEEN_APPROX_HPP_
+
+#include "filter.hpp"
+#include "internal/iterbase.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace iter {
+  namespace impl {
+    // A Bloom filter split into 512 bit blocks, one cache line each.  Each
+    // value picks a block from one part of its hash and then sets all of
+    // its bits within that block, so adding or checking a value touches a
+    // single cache line.
+    class BlockedBloomFilter {
+     private:
+      static constexpr std::size_t BLOCK_BITS = 512;
+      static constexpr std::size_t WORDS_PER_BLOCK = BLOCK_BITS / 64;
+      using Block = std::array<std::uint64_t, WORDS_PER_BLOCK>;
+
+      std::vector<Block> blocks_;
+      std::size_t num_hashes_;
+
+      static std::uint64_t mix(std::uint64_t x) {
+        x ^= x >> 33;
+        x *= 0xff51afd7ed558ccdULL;
+        x ^= x >> 33;
+        x *= 0xc4ceb9fe1a85ec53ULL;
+        x ^= x >> 33;
+        return x;
+      }
+
+     public:
+      // sized for expected_n values at a false positive rate of fp_rate
+      BlockedBloomFilter(std::size_t expected_n, double fp_rate) {
+        fp_rate = std::clamp(fp_rate, 1e-9, 0.5);
+        const double ln2 = std::log(2.0);
+        const double bits_per_value = -std::log(fp_rate) / (ln2 * ln2);
+        const double bits =
+            bits_per_value * static_cast<double>(std::max<std::size_t>(
+                                 expected_n, 1));
+        blocks_.resize(static_cast<std::size_t>(
+                           std::ceil(bits / static_cast<double>(BLOCK_BITS))),
+            Block{});
+        num_hashes_ = std::clamp<std::size_t>(
+            static_cast<std::size_t>(std::lround(bits_per_value * ln2)), 1,
+            16);
+      }
+
+      // Adds a value with the given hash.  Returns true if it (probably)
+      // wasn't there already, false if it definitely was
+      bool insert(std::size_t hash) {
+        const std::uint64_t h = mix(hash);
+        Block& block = blocks_[static_cast<std::size_t>(
+            ((h >> 32) * blocks_.size()) >> 32)];
+        // double hashing within the block, the step comes from a second
+        // hash since the high bits of h already picked the block
+        std::uint32_t bit = static_cast<std::uint32_t>(h);
+        const std::uint32_t step =
+            static_cast<std::uint32_t>(mix(h + 0x9e3779b97f4a7c15ULL)) | 1;
+        bool added = false;
+        for (std::size_t i = 0; i < num_hashes_; ++i, bit += step) {
+          const std::size_t b = bit % BLOCK_BITS;
+          const std::uint64_t mask = std::uint64_t{1} << (b % 64);
+          std::uint64_t& word = block[b / 64];
+          added |= !(word & mask);
+          word |= mask;
+        }
+        return added;
+      }
+    };
+
+    struct UniqueEverseenApproxFn;
+  }
+}
+
+// Like unique_everseen, but rather than remembering every value seen, it
+// keeps a Bloom filter with a memory budget fixed by the expected number of
+// distinct values and the acceptable false positive rate.  A false positive
+// means a value that was never seen before is wrongly dropped; a repeated
+// value is never yielded twice.
+struct iter::impl::UniqueEverseenApproxFn : Pipeable<UniqueEverseenApproxFn> {
+ private:
+  struct FnPartial : Pipeable<FnPartial> {
+    std::size_t expected_n;
+    double fp_rate;
+
+    template <typename Container>
+    auto operator()(Container&& container) const {
+      return UniqueEverseenApproxFn{}(
+          std::forward<Container>(container), expected_n, fp_rate);
+    }
+  };
+
+ public:
+  static constexpr double DEFAULT_FP_RATE = 0.001;
+
+  template <typename Container,
+      typename = std::enable_if_t<is_iterable<Container>>>
+  auto operator()(Container&& container, std::size_t expected_n,
+      double fp_rate = DEFAULT_FP_RATE) const {
+    using elem_type = impl::iterator_deref<Container>;
+    auto func = [seen = BlockedBloomFilter{expected_n, fp_rate}](
+        const std::remove_reference_t<elem_type>& e) mutable {
+      return seen.insert(std::hash<std::decay_t<elem_type>>{}(e));
+    };
+    return filter(func, std::forward<Container>(container));
+  }
+
+  FnPartial operator()(
+      std::size_t expected_n, double fp_rate = DEFAULT_FP_RATE) const {
+    return {{}, expected_n, fp_rate};
+  }
+};
+
+namespace iter {
+  constexpr impl::UniqueEverseenApproxFn unique_everseen_approx{};
+}
+
+#endif
@@ -0,0 +1,129 @@
+#ifndef ITER_UNIQUE_EVERSEEN_PARALLEL_HPP_
+#define ITER_UNIQUE_EVERSEEN_PARALLEL_HPP_
+
+#include "compress.hpp"
+#include "internal/flat_hash_set.hpp"
+#include "internal/iterbase.hpp"
+#include "internal/parallel.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace iter {
+  namespace impl {
+    struct UniqueEverseenParallelFn;
+  }
+}
+
+// Yields the same elements, in the same order, as unique_everseen, but
+// works out which ones to yield up front on several threads.  Requires a
+// sized random access iterable.
+//   1) the input is split into one block per thread, and each thread hashes
+//      the elements in its block and sorts their indices into shards by
+//      hash
+//   2) each thread takes a shard and runs through its indices in order,
+//      keeping the first index of each distinct element
+// Equal elements always land in the same shard, so the first index a shard
+// sees is the first occurrence overall.  The result is a compress of the
+// input with the kept indices as selectors.
+struct iter::impl::UniqueEverseenParallelFn
+    : Pipeable<UniqueEverseenParallelFn> {
+ private:
+  struct IndexHash {
+    const std::size_t* hashes;
+    std::size_t operator()(std::size_t i) const {
+      return hashes[i];
+    }
+  };
+
+  template <typename Iter>
+  struct IndexEqual {
+    Iter first;
+    const std::size_t* hashes;
+    bool operator()(std::size_t lhs, std::size_t rhs) const {
+      using Diff = typename std::iterator_traits<Iter>::difference_type;
+      return hashes[lhs] == hashes[rhs]
+             && first[static_cast<Diff>(lhs)] == first[static_cast<Diff>(rhs)];
+    }
+  };
+
+
+  struct FnPartial : Pipeable<FnPartial> {
+    std::size_t num_threads;
+    constexpr FnPartial(std::size_t in_num_threads)
+        : num_threads{in_num_threads} {}
+
+    template <typename Container>
+    auto operator()(Container&& container) const {
+      return UniqueEverseenParallelFn{}(
+          std::forward<Container>(container), num_threads);
+    }
+  };
+
+ public:
+  template <typename Container,
+      typename = std::enable_if_t<is_indexable<Container>>>
+  auto operator()(Container&& container,
+      std::size_t num_threads = std::thread::hardware_concurrency()) const {
+    using Elem = std::decay_t<iterator_deref<Container>>;
+    using Diff = typename std::iterator_traits<
+        iterator_type<Container>>::difference_type;
+    const std::size_t size = std::size(container);
+    auto first = get_begin(container);
+
+    std::size_t num_blocks = std::max<std::size_t>(
+        std::min<std::size_t>(num_threads, size / MIN_PARALLEL_BLOCK_SIZE), 1);
+    const std::size_t block_size =
+        std::max<std::size_t>((size + num_blocks - 1) / num_blocks, 1);
+    // rounding up the block size can leave the last blocks empty
+    num_blocks = std::max<std::size_t>((size + block_size - 1) / block_size, 1);
+    const std::size_t num_shards = num_blocks;
+
+    // shard_indices[b][s] holds the indices in block b that belong to
+    // shard s, in order
+    std::vector<std::size_t> hashes(size);
+    std::vector<std::vector<std::vector<std::size_t>>> shard_indices(
+        num_blocks, std::vector<std::vector<std::size_t>>(num_shards));
+    run_parallel(num_blocks, [&](std::size_t b) {
+      const std::size_t start = b * block_size;
+      const std::size_t stop = std::min(start + block_size, size);
+      for (std::size_t i = start; i < stop; ++i) {
+        const std::size_t h = std::hash<Elem>{}(first[static_cast<Diff>(i)]);
+        hashes[i] = h;
+        shard_indices[b][h % num_shards].push_back(i);
+      }
+    });
+
+    // each thread writes only the flags of its own shard's indices, a char
+    // each so no two threads write the same byte
+    std::vector<char> keep(size);
+    run_parallel(num_shards, [&](std::size_t s) {
+      FlatHashSet<std::size_t, IndexHash, IndexEqual<decltype(first)>> seen{
+          IndexHash{hashes.data()}, {first, hashes.data()}};
+      for (std::size_t b = 0; b < num_blocks; ++b) {
+        for (std::size_t i : shard_indices[b][s]) {
+          keep[i] = seen.insert(i);
+        }
+      }
+    });
+
+    return compress(std::forward<Container>(container),
+        std::vector<bool>(keep.begin(), keep.end()));
+  }
+
+  FnPartial operator()(std::size_t num_threads) const {
+    return {num_threads};
+  }
+};
+
+namespace iter {
+  constexpr impl::UniqueEverseenParallelFn unique_everseen_parallel{};
+}
+
+#endif
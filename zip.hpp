@@ -31,6 +31,19 @@ class iter::impl::Zipped {
 
   Zipped(TupleType&& containers) : containers_(std::move(containers)) {}
 
+  // When every zipped iterable is sized and random access, the length of
+  // the zip is computed once up front and the Iterator uses a single
+  // index rather than comparing every sub iterator against its end.
+  template <typename TupleTypeT>
+  static constexpr bool all_indexable = sizeof...(Is) != 0
+      && (... && is_indexable<std::tuple_element_t<Is,
+                     std::remove_reference_t<TupleTypeT>>>);
+
+  std::size_t min_size() const {
+    return std::min({static_cast<std::size_t>(
+        std::size(std::get<Is>(containers_)))...});
+  }
+
  public:
   Zipped(Zipped&&) = default;
 
@@ -50,18 +63,27 @@ class iter::impl::Zipped {
    public:
 #endif
     IteratorTuple<TupleTypeT> iters_;
+    // only used when indexed, otherwise iters_ are advanced directly
+    std::size_t index_;
 
    public:
+    static constexpr bool indexed = all_indexable<TupleTypeT>;
+
     using iterator_category = std::input_iterator_tag;
     using value_type = TupleDeref<TupleTypeT>;
     using difference_type = std::ptrdiff_t;
     using pointer = value_type*;
     using reference = value_type&;
 
-    Iterator(IteratorTuple<TupleTypeT>&& iters) : iters_(std::move(iters)) {}
+    Iterator(IteratorTuple<TupleTypeT>&& iters, std::size_t index = 0)
+        : iters_(std::move(iters)), index_{index} {}
 
     Iterator& operator++() {
-      absorb(++std::get<Is>(iters_)...);
+      if constexpr (indexed) {
+        ++index_;
+      } else {
+        absorb(++std::get<Is>(iters_)...);
+      }
       return *this;
     }
 
@@ -76,6 +98,8 @@ class iter::impl::Zipped {
     bool operator!=(const Iterator<T, IT, TD>& other) const {
       if constexpr (sizeof...(Is) == 0) {
         return false;
+      } else if constexpr (indexed) {
+        return index_ != other.index_;
       } else {
         return (... && (std::get<Is>(iters_) != std::get<Is>(other.iters_)));
       }
@@ -88,7 +112,11 @@ class iter::impl::Zipped {
     }
 
     TupleDeref<TupleTypeT> operator*() {
-      return {(*std::get<Is>(iters_))...};
+      if constexpr (indexed) {
+        return {std::get<Is>(iters_)[static_cast<difference_type>(index_)]...};
+      } else {
+        return {(*std::get<Is>(iters_))...};
+      }
     }
 
     auto operator-> () -> ArrowProxy<decltype(**this)> {
@@ -101,7 +129,12 @@ class iter::impl::Zipped {
   }
 
   Iterator<TupleType, iterator_tuple_type, iterator_deref_tuple> end() {
-    return {{get_end(std::get<Is>(containers_))...}};
+    if constexpr (Iterator<TupleType, iterator_tuple_type,
+                      iterator_deref_tuple>::indexed) {
+      return {{get_begin(std::get<Is>(containers_))...}, min_size()};
+    } else {
+      return {{get_end(std::get<Is>(containers_))...}};
+    }
   }
 
   Iterator<AsConst<TupleType>, const_iterator_tuple_type,
@@ -113,7 +146,23 @@ class iter::impl::Zipped {
   Iterator<AsConst<TupleType>, const_iterator_tuple_type,
       const_iterator_deref_tuple>
   end() const {
-    return {{get_end(std::as_const(std::get<Is>(containers_)))...}};
+    if constexpr (Iterator<AsConst<TupleType>, const_iterator_tuple_type,
+                      const_iterator_deref_tuple>::indexed) {
+      return {{get_begin(std::as_const(std::get<Is>(containers_)))...},
+          min_size()};
+    } else {
+      return {{get_end(std::as_const(std::get<Is>(containers_)))...}};
+    }
+  }
+
+  // Length of the shortest zipped iterable, available when every zipped
+  // iterable works with std::size()
+  template <typename T = TupleType,
+      typename = std::enable_if_t<std::tuple_size<T>::value != 0
+                                  && (... && has_size<std::tuple_element_t<Is,
+                                                 T>>)>>
+  std::size_t size() const {
+    return min_size();
   }
 };
 